@@ -1,12 +1,266 @@
+// mremap 을 사용하기 위해 헤더들보다 먼저 정의한다.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "dynamicIntArray.h"
+#include "dynamicIntArraySimd.h"
+
+// 원소 하나를 형식화했을 때의 최대 길이 (" -2147483648," 13 바이트와 마지막 " }" 를 담을 여유 포함)
+#define FORMAT_ELEMENT_MAX_LENGTH	16
+
+// 문자열 파서에서 8 자리 숫자를 한 번에 변환(SWAR)할지 여부 (리틀 엔디안에서만 사용)
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define PARSE_USE_SWAR	1
+#else
+#define PARSE_USE_SWAR	0
+#endif
+
+// 현재 플랫폼이 빅 엔디안인지 여부 (이진 파일의 바이트 순서 플래그에 사용)
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define HOST_IS_BIG_ENDIAN	1
+#else
+#define HOST_IS_BIG_ENDIAN	0
+#endif
+
+// Adler-32 체크섬 모듈러 값과, 32 비트 누적값이 넘치지 않고 더할 수 있는 최대 바이트 수
+#define ADLER32_MODULO		65521U
+#define ADLER32_MAX_BLOCK	5552
+
+// 할당자들이 반환하는 메모리의 정렬 단위 (바이트)
+#define ALLOCATOR_ALIGNMENT			((size_t)_Alignof(max_align_t))
+// 크기를 할당자 정렬 단위의 배수로 올림하는 매크로 함수
+#define ALLOCATOR_ALIGN_UP(size)	(((size) + ALLOCATOR_ALIGNMENT - 1) & ~(ALLOCATOR_ALIGNMENT - 1))
+// 풀 할당자의 가장 작은 크기 등급의 log2 값
+#define POOL_MIN_CLASS_SHIFT		4
+// 재사용 캐시에서 관리 구조체 목록을 나타내는 크기 등급 값 (원소 메모리 크기 등급들 다음)
+#define RECYCLE_HEADER_CLASS		DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT
+
+_Static_assert(sizeof(int) == 4, "dynamicIntArray binary format requires 32-bit int");
+_Static_assert(sizeof(dynamicIntArrayFileHeader_t) == 32, "dynamicIntArrayFileHeader_t must be 32 bytes");
+_Static_assert(sizeof(dynamicIntArraySharedHeader_t) == 64, "dynamicIntArraySharedHeader_t must be 64 bytes");
+_Static_assert(DYNAMIC_INT_ARRAY_NPOS == SIMD_NPOS, "search kernels must report not found as DYNAMIC_INT_ARRAY_NPOS");
+_Static_assert(DYNAMIC_INT_ARRAY_POOL_MIN_CLASS_SIZE == ((size_t)1 << POOL_MIN_CLASS_SHIFT), "POOL_MIN_CLASS_SHIFT must match DYNAMIC_INT_ARRAY_POOL_MIN_CLASS_SIZE");
+
+// 형식화된 문자열 조각을 전달받아 내보내는 함수 포인터 (성공 시 SUCCESS, 실패 시 FAIL 반환)
+typedef int (*formatSink_f)(const char *text, size_t length, void *context);
+
+// 기본 할당자의 쓰레드별 재사용 캐시 (Static Variables 에서 정의)
+typedef struct recycleCache_s recycleCache_t;
+
+// 쓰레드별 출력 링 버퍼 (Static Variables 에서 정의)
+typedef struct printRing_s printRing_t;
 
 ///////////////////////////////////////////////////////////////////////////////////////
 /// Predefinitions of Static Util Functions
 ///////////////////////////////////////////////////////////////////////////////////////
 
-static int getBufferSize(const char *format, ...);
-static int getDigitOfNumber(int number);
-static int addNumberToString(char *string, int number);
+static void printRecordMsg(int type, const char *msg, va_list argPointer);
+static void printDiagnosticMsg(const char *msg, ...);
+static void printDefaultSink(int type, const char *text, void *context);
+static void printToSink(int type, const char *text);
+static void flushPrintRing(printRing_t *ring);
+static void registerPrintRing(printRing_t *ring);
+static void createPrintRingKey(void);
+static void releasePrintRing(void *context);
+static void flushPrintRingAtExit(void);
+static size_t getDigitOfNumber(int number);
+static size_t formatNumber(char *buf, int number);
+static size_t getFormattedLength(const int *data, size_t size);
+static ssize_t formatArray(const int *data, size_t size, formatSink_f sink, void *context);
+static int formatBufferSink(const char *text, size_t length, void *context);
+static int formatFdSink(const char *text, size_t length, void *context);
+static int formatFileSink(const char *text, size_t length, void *context);
+static int writeAll(int fd, const void *buffer, size_t length);
+static size_t readAll(int fd, void *buffer, size_t length);
+static uint32_t updateChecksum(uint32_t checksum, const void *data, size_t length);
+static int checkFileHeader(dynamicIntArrayFileHeader_t *header, int *isSwapped);
+static int isSpaceCharacter(char character);
+static int isEightDigits(const char *text);
+static unsigned int parseEightDigits(const char *text);
+static int parserFail(dynamicIntArrayParser_t *parser, size_t index, const char *reason);
+static dynamicIntArray_t *newWithCapacity(size_t size, size_t capacity, const dynamicIntArrayAllocator_t *allocator, const char *caller);
+static int initializeWithCapacity(dynamicIntArray_t *array, size_t size, size_t capacity, const dynamicIntArrayAllocator_t *allocator);
+static int reallocateCapacity(dynamicIntArray_t *array, size_t capacity);
+static int growCapacity(dynamicIntArray_t *array, size_t requiredSize);
+static int shrinkCapacity(dynamicIntArray_t *array);
+static int prepareWrite(dynamicIntArray_t *array, const char *caller);
+static int narrowIndex(size_t index, const char *caller);
+static int isHugeCapacity(const dynamicIntArray_t *array, size_t capacity);
+static int isInlineStorage(const dynamicIntArray_t *array);
+static int isAllocatorOwned(const dynamicIntArray_t *array);
+static int isAllocatorBound(const dynamicIntArray_t *array);
+static void releaseStorage(dynamicIntArray_t *array);
+static void setEmptyStorage(dynamicIntArray_t *array);
+static void takeStorage(dynamicIntArray_t *dst, dynamicIntArray_t *src);
+static int detachAdoptedStorage(dynamicIntArray_t *array, size_t capacity);
+static int detachCowStorage(dynamicIntArray_t *array);
+static int initializeArrayView(const dynamicIntArray_t *array, size_t from, size_t length, int isReadOnly, dynamicIntArrayView_t *view, const char *caller);
+static int checkView(const dynamicIntArrayView_t *view, const char *caller);
+static int checkWritableView(const dynamicIntArrayView_t *view, const char *caller);
+static int initializeWholeArrayView(const dynamicIntArray_t *array, dynamicIntArrayView_t *view, const char *caller);
+static int64_t sumViewElements(const dynamicIntArrayView_t *view);
+static int reduceViewMinMax(const dynamicIntArrayView_t *view, int *min, int *max, const char *caller);
+static int checkPredicateCall(const dynamicIntArray_t *array, compareIntWithContext_f func, const char *caller);
+static size_t findIfFrom(const int *data, size_t from, size_t size, compareIntWithContext_f func, void *context);
+static int compilePredicateNode(const dynamicIntArrayPredicate_t *node, dynamicIntArrayPredicateProgram_t *program, size_t depth);
+static int addPredicateStep(dynamicIntArrayPredicateProgram_t *program, int kind, int operand1, int operand2);
+static int checkPredicateProgram(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program, const char *caller);
+static void *allocateZeroed(const dynamicIntArrayAllocator_t *allocator, size_t size);
+static int checkAllocator(const dynamicIntArrayAllocator_t *allocator, const char *caller);
+static void *libcAllocate(void *context, size_t size);
+static void *libcReallocate(void *context, void *pointer, size_t oldSize, size_t newSize);
+static void libcDeallocate(void *context, void *pointer, size_t size);
+static int getRecycleClass(size_t size);
+static size_t getRecycleClassSize(int sizeClass);
+static int registerRecycleCache(recycleCache_t *cache);
+static void createRecycleKey(void);
+static void releaseRecycleCache(void *context);
+static size_t trimRecycleCache(recycleCache_t *cache);
+static void *arenaAllocate(void *context, size_t size);
+static void *arenaReallocate(void *context, void *pointer, size_t oldSize, size_t newSize);
+static void arenaDeallocate(void *context, void *pointer, size_t size);
+static int getPoolClass(size_t size);
+static void *poolAllocate(void *context, size_t size);
+static void *poolReallocate(void *context, void *pointer, size_t oldSize, size_t newSize);
+static void poolDeallocate(void *context, void *pointer, size_t size);
+static int allocateHugeStorage(dynamicIntArray_t *array, size_t capacity);
+static int remapHugeStorage(dynamicIntArray_t *array, size_t capacity);
+static int remapCapacity(dynamicIntArray_t *array, size_t capacity);
+static int remapStorage(dynamicIntArray_t *array, size_t mapLength);
+static void updateMappedHeader(const dynamicIntArray_t *array);
+static void publishSharedHeader(dynamicIntArray_t *array);
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Static Variables
+///////////////////////////////////////////////////////////////////////////////////////
+
+// 두 자리 숫자 문자 테이블 ("00" ~ "99", 정수를 두 자리씩 문자열로 변환할 때 사용)
+static const char digitPairTable[201] =
+	"00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+// 호출자가 제공한 버퍼에 형식화된 문자열을 복사하는 formatBufferSink 의 상태 구조체
+typedef struct formatBuffer_s formatBuffer_t;
+struct formatBuffer_s
+{
+	// 복사할 버퍼
+	char *buffer;
+	// 버퍼 크기 (널 문자 포함)
+	size_t capacity;
+	// 지금까지 복사한 길이
+	size_t length;
+};
+
+// 출력 링 버퍼에 기록되는 메시지 구조체
+typedef struct printRecord_s printRecord_t;
+struct printRecord_s
+{
+	// 출력 형태 (PRINT_TYPE 열거형 참고)
+	int type;
+	// 형식화된 메시지
+	char text[PRINT_RING_SLOT_SIZE];
+};
+
+// 쓰레드별 출력 링 버퍼 구조체 (쓰레드마다 하나씩 있으므로 잠금이 필요 없다)
+struct printRing_s
+{
+	// 가장 오래된 메시지의 슬롯 인덱스
+	unsigned int tail;
+	// 기록된 메시지 개수
+	unsigned int count;
+	// 메시지 슬롯 배열
+	printRecord_t records[PRINT_RING_SLOT_COUNT];
+	// 쓰레드가 끝날 때 링 버퍼를 비우도록 쓰레드 키에 등록했는지 여부
+	int isRegistered;
+};
+
+// 아레나 할당자의 메모리 블록 구조체 (ALLOCATOR_ALIGN_UP(sizeof(구조체)) 다음부터 할당할 메모리가 이어짐)
+struct dynamicIntArrayArenaBlock_s
+{
+	// 이전 블록
+	dynamicIntArrayArenaBlock_t *next;
+	// 할당할 수 있는 크기 (바이트, 블록 헤더 제외)
+	size_t size;
+	// 지금까지 할당한 크기 (바이트)
+	size_t used;
+};
+
+// 풀 할당자의 slab 구조체 (ALLOCATOR_ALIGN_UP(sizeof(구조체)) 다음부터 크기 등급 조각들이 이어짐)
+struct dynamicIntArrayPoolSlab_s
+{
+	// 이전 slab
+	dynamicIntArrayPoolSlab_t *next;
+	// 지금까지 잘라 쓴 크기 (바이트)
+	size_t used;
+};
+
+// 풀 할당자가 따로 할당한 큰 메모리 블록 구조체 (ALLOCATOR_ALIGN_UP(sizeof(구조체)) 다음부터 메모리가 이어짐)
+struct dynamicIntArrayPoolLarge_s
+{
+	// 이전 블록 (목록의 처음이면 NULL)
+	dynamicIntArrayPoolLarge_t *prev;
+	// 다음 블록 (목록의 끝이면 NULL)
+	dynamicIntArrayPoolLarge_t *next;
+};
+
+// copy-on-write 복제본들이 함께 사용하는 원소 저장소의 참조 횟수 블록 (원소 저장소는 각 구조체의 저장소 멤버들이 똑같이 가리킴)
+struct dynamicIntArrayCowBlock_s
+{
+	// 원소 저장소를 함께 사용하는 동적 배열 개수 (마지막으로 해제하는 쪽이 저장소와 블록을 해제)
+	atomic_size_t refCount;
+};
+
+// 기본 할당자의 쓰레드별 재사용 캐시 구조체
+// 보관 중인 메모리의 첫 8 바이트에 같은 목록의 다음 메모리 주소를 저장한다.
+struct recycleCache_s
+{
+	// 크기 등급별로 보관 중인 메모리 목록 (마지막 RECYCLE_HEADER_CLASS 는 관리 구조체 목록)
+	void *freeLists[DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT + 1];
+	// 크기 등급별로 보관 중인 메모리 개수
+	size_t counts[DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT + 1];
+	// 캐시에서 꺼내서 할당한 횟수와 malloc 으로 할당한 횟수
+	size_t hits;
+	size_t misses;
+	// 캐시에 보관한 횟수와 캐시가 가득 차서 free 로 해제한 횟수
+	size_t recycled;
+	size_t released;
+	// 쓰레드가 끝날 때 캐시를 해제하도록 쓰레드 키에 등록했는지 여부
+	int isRegistered;
+};
+
+// C 라이브러리의 malloc/realloc/free 를 사용하는 기본 할당자 (작은 메모리는 쓰레드별 재사용 캐시를 먼저 사용)
+static const dynamicIntArrayAllocator_t libcAllocator = { libcAllocate, libcReallocate, libcDeallocate, NULL };
+
+// 실행 중 출력 수준 (printSetLevel 참고, 다른 쓰레드가 읽는 동안 바뀔 수 있으므로 원자적으로 접근)
+static atomic_int printRuntimeLevel = DEBUG;
+// 출력 sink 함수와 사용자 데이터 (printSetSink 참고, 사용자 데이터를 먼저 저장하고 함수를 release 로 게시)
+static _Atomic(printSink_f) printSink = printDefaultSink;
+static _Atomic(void*) printSinkContext = NULL;
+// 출력 링 버퍼 버퍼링 여부 (printSetBuffered 참고)
+static atomic_int printIsBuffered = NO;
+// 쓰레드별 출력 링 버퍼
+static _Thread_local printRing_t printThreadRing;
+// 쓰레드가 끝날 때 출력 링 버퍼를 비우는 쓰레드 키와 생성 여부
+static pthread_key_t printRingKey;
+static pthread_once_t printRingKeyOnce = PTHREAD_ONCE_INIT;
+static int isPrintRingKeyCreated = NO;
+// 큰 배열 모드로 전환하는 크기 (dynamicIntArraySetHugeThreshold 참고)
+static size_t hugeThreshold = DYNAMIC_INT_ARRAY_HUGE_THRESHOLD;
+// 할당자를 지정하지 않고 생성하는 동적 배열이 사용할 할당자 (dynamicIntArraySetDefaultAllocator 참고)
+static const dynamicIntArrayAllocator_t *defaultAllocator = &libcAllocator;
+// 쓰레드별 재사용 캐시 (dynamicIntArrayGetRecycleStats 참고)
+static _Thread_local recycleCache_t recycleThreadCache;
+// 재사용 캐시가 크기 등급마다 보관하는 최대 개수 (dynamicIntArraySetRecycleLimit 참고)
+static size_t recycleLimit = DYNAMIC_INT_ARRAY_RECYCLE_LIMIT;
+// 쓰레드가 끝날 때 재사용 캐시를 해제하는 쓰레드 키와 생성 여부
+static pthread_key_t recycleKey;
+static pthread_once_t recycleKeyOnce = PTHREAD_ONCE_INIT;
+static int isRecycleKeyCreated = NO;
+// 쓰레드별 마지막 오류 코드 (dynamicIntArrayGetLastError 참고)
+static _Thread_local int lastErrorCode = ERROR_NONE;
 
 ///////////////////////////////////////////////////////////////////////////////////////
 /// Functions for dynamicIntArray_t
@@ -20,15 +274,78 @@ static int addNumberToString(char *string, int number);
  */
 dynamicIntArray_t *dynamicIntArrayNew(int size)
 {
-	dynamicIntArray_t *array = (dynamicIntArray_t*)malloc(sizeof(dynamicIntArray_t));
-	if(dynamicIntArrayInitialize(array, size) == FAIL)
+	if(size <= 0)
 	{
-		printMsg("초기화 실패, 생성한 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayNew)", DEBUG, 0);
-		free(array);
+		PRINT_MSG("크기 지정 실패. 크기가 0 보다 작거나 같음. (dynamicIntArrayNew, size:%d)", ERROR, 1, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
 		return NULL;
 	}
 
-	return array;
+	return newWithCapacity((size_t)size, (size_t)size, defaultAllocator, "dynamicIntArrayNew");
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayNewWithCapacity(int capacity)
+ * @brief 크기가 0 이고 지정한 용량이 미리 할당된 동적 배열 관리 구조체를 새로 생성하는 함수
+ * 최종 원소 개수를 미리 알고 있을 때 사용하면 원소 추가 중에 재할당이 발생하지 않는다.
+ * @param capacity 미리 할당할 용량(입력)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayNewWithCapacity(int capacity)
+{
+	if(capacity <= 0)
+	{
+		PRINT_MSG("용량 지정 실패. 용량이 0 보다 작거나 같음. (dynamicIntArrayNewWithCapacity, capacity:%d)", ERROR, 1, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	return newWithCapacity(0, (size_t)capacity, defaultAllocator, "dynamicIntArrayNewWithCapacity");
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayNewWithAllocator(int capacity, const dynamicIntArrayAllocator_t *allocator)
+ * @brief 지정한 할당자로 크기가 0 이고 지정한 용량이 미리 할당된 동적 배열 관리 구조체를 새로 생성하는 함수
+ * 구조체와 동적 배열, 문자열을 모두 지정한 할당자로 할당하므로 아레나나 풀 할당자를 지정하면
+ * dynamicIntArrayArenaReset, dynamicIntArrayPoolReset 으로 생성한 동적 배열들을 한 번에 해제할 수 있다.
+ * 할당자는 동적 배열을 해제할 때까지 유효해야 한다.
+ * @param capacity 미리 할당할 용량(입력)
+ * @param allocator 사용할 할당자(입력, 읽기 전용)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayNewWithAllocator(int capacity, const dynamicIntArrayAllocator_t *allocator)
+{
+	if(checkAllocator(allocator, "dynamicIntArrayNewWithAllocator") == FAIL)
+	{
+		return NULL;
+	}
+
+	if(capacity <= 0)
+	{
+		PRINT_MSG("용량 지정 실패. 용량이 0 보다 작거나 같음. (dynamicIntArrayNewWithAllocator, capacity:%d)", ERROR, 1, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	return newWithCapacity(0, (size_t)capacity, allocator, "dynamicIntArrayNewWithAllocator");
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayNew64(size_t size)
+ * @brief 동적 배열 관리 구조체를 새로 생성하는 함수 (size_t 크기, 원소는 0 으로 초기화)
+ * @param size 동적 배열을 생성할 크기(입력, 1 ~ DYNAMIC_INT_ARRAY_MAX_SIZE)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayNew64(size_t size)
+{
+	if((size == 0) || (size > DYNAMIC_INT_ARRAY_MAX_SIZE))
+	{
+		PRINT_MSG("크기 지정 실패. 크기가 0 이거나 최대 크기 초과. (dynamicIntArrayNew64, size:%zu)", ERROR, 1, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	return newWithCapacity(size, size, defaultAllocator, "dynamicIntArrayNew64");
 }
 
 /**
@@ -47,26 +364,19 @@ int dynamicIntArrayInitialize(dynamicIntArray_t *array, int size)
 
 	if(size <= 0)
 	{
-		printMsg("크기 지정 실패. 크기가 0 보다 작거나 같음. (dynamicIntArrayInitialize, size:%d)", ERROR, 1, size);
-		return FAIL;
-	}
-
-	array->size = size;
-	array->stringOfArray = NULL;
-
-	size_t totalSize = (size_t)size * sizeof(int);
-	array->data = (int*)calloc(totalSize, sizeof(int));
-	if(checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayInitialize)") == YES)
-	{
+		PRINT_MSG("크기 지정 실패. 크기가 0 보다 작거나 같음. (dynamicIntArrayInitialize, size:%d)", ERROR, 1, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
 		return FAIL;
 	}
 
-	return SUCCESS;
+	return initializeWithCapacity(array, (size_t)size, (size_t)size, defaultAllocator);
 }
 
 /**
  * @fn dynamicIntArray_t *dynamicIntArrayResize(dynamicIntArray_t *array, int size, int isKeep)
  * @brief 동적 배열 관리 구조체가 관리하고 있는 동적 배열을 재생성하는 함수
+ * 동적 배열의 크기와 용량을 모두 지정한 크기로 변경한다.
+ * 데이터를 유지하면서 크기가 커지면 새로 추가된 원소들은 0 으로 초기화된다.
  * @param array 동적 배열 관리 구조체 포인터(입력)
  * @param size  변경할 크기(입력)
  * @param isKeep 재생성 시 기존 데이터 유지 여부(입력)
@@ -81,942 +391,6685 @@ dynamicIntArray_t *dynamicIntArrayResize(dynamicIntArray_t *array, int size, int
 
 	if(size <= 0)
 	{
-		printMsg("동적 배열의 크기가 0 보다 작거나 같음. (dynamicIntArrayResize, size:%d)", ERROR, 1, size);
+		PRINT_MSG("동적 배열의 크기가 0 보다 작거나 같음. (dynamicIntArrayResize, size:%d)", ERROR, 1, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	return dynamicIntArrayResize64(array, (size_t)size, isKeep);
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayResize64(dynamicIntArray_t *array, size_t size, int isKeep)
+ * @brief 동적 배열 관리 구조체가 관리하고 있는 동적 배열을 재생성하는 함수 (size_t 크기)
+ * 동적 배열의 크기와 용량을 모두 지정한 크기로 변경한다.
+ * 데이터를 유지하면서 크기가 커지면 새로 추가된 원소들은 0 으로 초기화된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param size  변경할 크기(입력, 1 ~ DYNAMIC_INT_ARRAY_MAX_SIZE)
+ * @param isKeep 재생성 시 기존 데이터 유지 여부(입력)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayResize64(dynamicIntArray_t *array, size_t size, int isKeep)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayResize64)") == YES)
+	{
+		return NULL;
+	}
+
+	if((size == 0) || (size > DYNAMIC_INT_ARRAY_MAX_SIZE))
+	{
+		PRINT_MSG("동적 배열의 크기가 0 이거나 최대 크기 초과. (dynamicIntArrayResize64, size:%zu)", ERROR, 1, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
 		return NULL;
 	}
 
 	if((isKeep != YES) && (isKeep != NO))
 	{
-		printMsg("알 수 없는 isKeep 변수 값 사용. 재생성 취소. (dynamicIntArrayResize, isKeep:%d)", ERROR, 1, isKeep);
+		PRINT_MSG("알 수 없는 isKeep 변수 값 사용. 재생성 취소. (dynamicIntArrayResize64, isKeep:%d)", ERROR, 1, isKeep);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayResize64") == FAIL)
+	{
 		return NULL;
 	}
 
 	int *arrayData = NULL;
-	size_t totalSize = (size_t)size * sizeof(int);
 
-	if(isKeep == YES)
+	// 매핑 저장소는 다른 메모리로 바꿀 수 없고 큰 배열은 큰 배열 모드로, 작은 배열은 인라인 저장소로 옮겨야 하므로, 재할당한 뒤 0 으로 채운다.
+	// (기존 원소는 버리므로 크기를 0 으로 두고 재할당해서 복사하지 않게 한다)
+	if((isKeep == NO) && ((array->storageKind != STORAGE_HEAP) || (isHugeCapacity(array, size) == YES)
+			|| (size <= DYNAMIC_INT_ARRAY_INLINE_CAPACITY) || (isInlineStorage(array) == YES)))
+	{
+		size_t oldSize = array->size;
+		array->size = 0;
+		if(reallocateCapacity(array, size) == FAIL)
+		{
+			PRINT_MSG("메모리 재생성 실패. reallocateCapacity 실패. (dynamicIntArrayResize64, size:%zu)", DEBUG, 1, size);
+			array->size = oldSize;
+			return NULL;
+		}
+		memset(array->data, 0, size * sizeof(int));
+	}
+	else if(isKeep == YES)
 	{
-		arrayData = (int*)realloc(array->data, totalSize);
-		if(checkObjectNull(arrayData, "메모리 참조 실패, 재생성한 동적 배열이 NULL. (dynamicIntArrayResize)") == YES)
+		size_t oldSize = array->size;
+		if(reallocateCapacity(array, size) == FAIL)
 		{
+			PRINT_MSG("메모리 재생성 실패. reallocateCapacity 실패. (dynamicIntArrayResize64, size:%zu)", DEBUG, 1, size);
 			return NULL;
 		}
+
+		if(size > oldSize)
+		{
+			memset(array->data + oldSize, 0, (size - oldSize) * sizeof(int));
+		}
 	}
 	else if(isKeep == NO)
 	{
-		arrayData = (int*)calloc(totalSize, sizeof(int));
-		if(checkObjectNull(arrayData, "메모리 참조 실패, 새로 생성한 동적 배열이 NULL. (dynamicIntArrayResize)") == YES)
+		arrayData = (int*)allocateZeroed(array->allocator, size * sizeof(int));
+		if(checkObjectNull(arrayData, "메모리 참조 실패, 새로 생성한 동적 배열이 NULL. (dynamicIntArrayResize64)") == YES)
 		{
+			dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
 			return NULL;
 		}
-		free(array->data);
+		array->allocator->deallocate(array->allocator->context, array->data, array->capacity * sizeof(int));
+		array->data = arrayData;
+		array->capacity = size;
 	}
 
-	array->data = arrayData;
+	array->size = size;
 	return array;
 }
 
 /**
- * @fn int dynamicIntArrayClear(dynamicIntArray_t *array)
- * @brief 동적 배열 관리 구조체의 동적 배열 관련 멤버 변수들을 모두 0 으로 설정하는 함수
+ * @fn int dynamicIntArrayReserve(dynamicIntArray_t *array, int capacity)
+ * @brief 동적 배열의 용량을 최소 지정한 용량 이상으로 미리 확보하는 함수
+ * 예약한 용량은 원소 삭제로 인한 용량 축소 시에도 유지되므로,
+ * 예약 이후 크기가 예약한 용량을 넘지 않는 한 재할당이 발생하지 않는다.
  * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param capacity 확보할 용량(입력)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-int dynamicIntArrayClear(dynamicIntArray_t *array)
+int dynamicIntArrayReserve(dynamicIntArray_t *array, int capacity)
 {
-	int *arrayData = dynamicIntArrayGetArrayPtr(array);
-	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayClear)") == YES)
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayReserve)") == YES)
 	{
 		return FAIL;
 	}
 
-	int size = array->size;
-	if(size <= 0)
+	if(capacity <= 0)
 	{
-		printMsg("동적 배열의 크기가 0 보다 작거나 같음. (dynamicIntArrayClear, size:%d)", DEBUG, 1, size);
+		PRINT_MSG("용량 지정 실패. 용량이 0 보다 작거나 같음. (dynamicIntArrayReserve, capacity:%d)", ERROR, 1, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
 		return FAIL;
 	}
 
-	size_t totalSize = (size_t)size * sizeof(int);
-	memset(arrayData, 0, totalSize);
-	array->size = 0;
+	if(prepareWrite(array, "dynamicIntArrayReserve") == FAIL)
+	{
+		return FAIL;
+	}
 
-	if(checkObjectNull(array->stringOfArray, NULL) == NO)
+	if(((size_t)capacity > array->capacity) && (reallocateCapacity(array, (size_t)capacity) == FAIL))
 	{
-		memset(array->stringOfArray, 0, strlen(array->stringOfArray));
+		PRINT_MSG("메모리 재생성 실패. reallocateCapacity 실패. (dynamicIntArrayReserve, capacity:%d)", DEBUG, 1, capacity);
+		return FAIL;
 	}
 
+	array->reservedCapacity = (size_t)capacity;
 	return SUCCESS;
 }
 
 /**
- * @fn int dynamicIntArrayFinal(dynamicIntArray_t *array)
- * @brief 동적 배열 관리 구조체의 멤버 변수의 동적으로 생성한 메모리는 해제하고 정적 변수는 0 으로 설정하는 함수
+ * @fn int dynamicIntArrayShrinkToFit(dynamicIntArray_t *array)
+ * @brief 동적 배열의 용량을 현재 크기에 맞게 줄이고 예약한 용량을 해제하는 함수
+ * 크기가 0 이면 용량은 1 로 줄어든다.
  * @param array 동적 배열 관리 구조체 포인터(입력)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-int dynamicIntArrayFinal(dynamicIntArray_t *array)
+int dynamicIntArrayShrinkToFit(dynamicIntArray_t *array)
 {
-	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayFinal)") == YES)
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayShrinkToFit)") == YES)
 	{
 		return FAIL;
 	}
 
-	if(checkObjectNull(array->data, NULL) == NO)
+	if(prepareWrite(array, "dynamicIntArrayShrinkToFit") == FAIL)
 	{
-		free(array->data);
-		array->data = NULL;
+		return FAIL;
 	}
 
-	if(checkObjectNull(array->stringOfArray, NULL) == NO)
+	size_t capacity = (array->size > 0) ? array->size : 1;
+	if(reallocateCapacity(array, capacity) == FAIL)
 	{
-		free(array->stringOfArray);
-		array->stringOfArray = NULL;
+		PRINT_MSG("메모리 재생성 실패. reallocateCapacity 실패. (dynamicIntArrayShrinkToFit, capacity:%zu)", DEBUG, 1, capacity);
+		return FAIL;
 	}
 
-	array->size = 0;
-
+	array->reservedCapacity = 0;
 	return SUCCESS;
 }
 
 /**
- * @fn void dynamicIntArrayDelete(dynamicIntArray_t **array)
- * @brief 동적 배열 관리 구조체의 생성한 메모리를 해제하는 함수
- * @param array 동적 배열 관리 구조체 포인터 변수의 주소를 가지는 포인터(더블 포인터, 입력, 읽기 전용)
- * @return 반환값 없음
+ * @fn int dynamicIntArraySetGrowthPolicy(dynamicIntArray_t *array, int factor, int minIncrement, int maxSlack)
+ * @brief 동적 배열의 용량 증가 정책을 설정하는 함수
+ * 용량이 부족하면 새 용량은 [현재 용량 * factor / 100] 과 [현재 용량 + minIncrement] 중 큰 값이 되고,
+ * maxSlack 이 0 보다 크면 [요구 크기 + maxSlack] 을 넘지 않도록 제한된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param factor 용량 증가 배율(입력, 백분율, 100 이상)
+ * @param minIncrement 용량 최소 증가량(입력, 0 이상, factor 가 100 이면 1 이상)
+ * @param maxSlack 용량 최대 여유 공간(입력, 0 이상, 0 이면 제한 없음)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-void dynamicIntArrayDelete(dynamicIntArray_t **array)
+int dynamicIntArraySetGrowthPolicy(dynamicIntArray_t *array, int factor, int minIncrement, int maxSlack)
 {
-	if(dynamicIntArrayFinal(*array) == FAIL)
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArraySetGrowthPolicy)") == YES)
 	{
-		printMsg("동적 배열 관리 구조체 메모리 해제 실패. dynamicIntArrayFinal 실패. (dynamicIntArrayDelete, array:%p)", DEBUG, 1, *array);
-		return;
+		return FAIL;
 	}
 
-	free(*array);
-	*array = NULL;
+	if((factor < 100) || (minIncrement < 0) || (maxSlack < 0) || ((factor == 100) && (minIncrement == 0)))
+	{
+		PRINT_MSG("알 수 없는 용량 증가 정책. (dynamicIntArraySetGrowthPolicy, factor:%d, minIncrement:%d, maxSlack:%d)", ERROR, 3, factor, minIncrement, maxSlack);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	array->growthFactor = factor;
+	array->growthMinIncrement = minIncrement;
+	array->growthMaxSlack = maxSlack;
+
+	return SUCCESS;
 }
 
 /**
- * @fn int dynamicIntArraySetElement(const dynamicIntArray_t *array, int index, int datum)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 특정 값을 저장하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param index 지정할 인덱스(입력)
- * @param datum 저장할 특정 값(입력)
+ * @fn void dynamicIntArraySetHugeThreshold(size_t bytes)
+ * @brief 동적 배열을 큰 배열 모드로 할당하기 시작하는 크기를 설정하는 함수
+ * 용량이 이 크기 이상이 되면 malloc 대신 익명 mmap 으로 할당하고 transparent hugepage(MADV_HUGEPAGE)를 요청한다.
+ * 큰 배열 모드에서 용량을 늘릴 때는 mremap 이 페이지를 옮기기만 하므로 원소를 복사하지 않는다.
+ * 이미 큰 배열 모드인 동적 배열에는 영향을 주지 않는다.
+ * @param bytes 기준 크기(입력, 바이트, 0 이면 기본값으로 되돌림, SIZE_MAX 면 사용 안 함)
+ * @return 반환값 없음
+ */
+void dynamicIntArraySetHugeThreshold(size_t bytes)
+{
+	hugeThreshold = (bytes == 0) ? DYNAMIC_INT_ARRAY_HUGE_THRESHOLD : bytes;
+}
+
+/**
+ * @fn size_t dynamicIntArrayGetHugeThreshold(void)
+ * @brief 동적 배열을 큰 배열 모드로 할당하기 시작하는 크기를 반환하는 함수
+ * @return 기준 크기 반환 (바이트)
+ */
+size_t dynamicIntArrayGetHugeThreshold(void)
+{
+	return hugeThreshold;
+}
+
+/**
+ * @fn int dynamicIntArraySetDefaultAllocator(const dynamicIntArrayAllocator_t *allocator)
+ * @brief 할당자를 지정하지 않고 생성하는 동적 배열들이 사용할 할당자를 설정하는 함수
+ * 이미 생성된 동적 배열은 생성할 때의 할당자를 계속 사용한다.
+ * 모든 쓰레드에 적용되므로 동적 배열을 생성하기 전에 설정해야 하고, 할당자는 그 동적 배열들을 해제할 때까지 유효해야 한다.
+ * dynamicIntArrayInitialize 로 초기화한 구조체도 원소를 이 할당자로 할당하므로 dynamicIntArrayFinal 로 해제해야 한다.
+ * 기본 할당자(malloc/realloc/free)를 사용할 때만 큰 배열 모드(dynamicIntArraySetHugeThreshold)가 적용된다.
+ * @param allocator 설정할 할당자(입력, 읽기 전용, NULL 이면 기본 할당자로 되돌림)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-int dynamicIntArraySetElement(const dynamicIntArray_t *array, int index, int datum)
+int dynamicIntArraySetDefaultAllocator(const dynamicIntArrayAllocator_t *allocator)
 {
-	if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+	if(allocator == NULL)
 	{
-		printMsg("Set 실패. 인덱스 오류. (dynamicIntArraySetElement)", ERROR, 0);
-		return FAIL;
+		defaultAllocator = &libcAllocator;
+		return SUCCESS;
 	}
 
-	if(checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayGetElement)") == YES)
+	if(checkAllocator(allocator, "dynamicIntArraySetDefaultAllocator") == FAIL)
 	{
 		return FAIL;
 	}
 
-	array->data[index] = datum;
-
+	defaultAllocator = allocator;
 	return SUCCESS;
 }
 
 /**
- * @fn int dynamicIntArrayGetElement(const dynamicIntArray_t *array, int index, int *isError)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 저장된 값을 반환하는 함수
+ * @fn const dynamicIntArrayAllocator_t *dynamicIntArrayGetDefaultAllocator(void)
+ * @brief 할당자를 지정하지 않고 생성하는 동적 배열들이 사용할 할당자를 반환하는 함수
+ * @return 현재 기본 할당자 반환
+ */
+const dynamicIntArrayAllocator_t *dynamicIntArrayGetDefaultAllocator(void)
+{
+	return defaultAllocator;
+}
+
+/**
+ * @fn const dynamicIntArrayAllocator_t *dynamicIntArrayGetAllocator(const dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체가 사용하는 할당자를 반환하는 함수
  * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param index 지정할 인덱스(입력)
- * @param isError 함수 실행 결과(출력, 함수 실행 성공 시 SUCCESS, 실패 시 FAIL 저장)
- * @return 성공 시 지정한 인덱스에 저장된 값, 실패 시 NONE 반환
+ * @return 성공 시 할당자, 실패 시 NULL 반환
  */
-int dynamicIntArrayGetElement(const dynamicIntArray_t *array, int index, int *isError)
+const dynamicIntArrayAllocator_t *dynamicIntArrayGetAllocator(const dynamicIntArray_t *array)
 {
-	if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetAllocator)") == YES)
 	{
-		printMsg("Get 실패. 인덱스 오류. (dynamicIntArrayGetElement)", ERROR, 0);
-		*isError = FAIL;
-		return NONE;
+		return NULL;
 	}
 
-	if(checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayGetElement)") == YES)
-	{
-		*isError = FAIL;
-		return NONE;
-	}
+	return array->allocator;
+}
 
-	*isError = SUCCESS;
-	return array->data[index];
+/**
+ * @fn void dynamicIntArraySetRecycleLimit(size_t count)
+ * @brief 기본 할당자의 쓰레드별 재사용 캐시가 크기 등급(과 관리 구조체 목록)마다 보관하는 최대 개수를 설정하는 함수
+ * 기본 할당자는 관리 구조체와 작은 원소 메모리(DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT 개 크기 등급, 4K 바이트 이하)를
+ * 해제할 때 free 대신 쓰레드별 캐시에 보관하고, 다음 할당에서 malloc 없이 다시 사용한다.
+ * 모든 쓰레드에 적용되며, 줄여도 이미 보관 중인 메모리는 dynamicIntArrayTrimRecycle 을 호출할 때까지 남아 있다.
+ * @param count 최대 보관 개수(입력, 0 이면 재사용 캐시 사용 안 함)
+ * @return 반환값 없음
+ */
+void dynamicIntArraySetRecycleLimit(size_t count)
+{
+	recycleLimit = count;
 }
 
 /**
- * @fn dynamicIntArray_t *dynamicIntArrayAppend(dynamicIntArray_t *array, int datum)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 끝에 새로운 값을 추가하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력)
- * @param datum 추가할 특정 값(입력)
- * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ * @fn size_t dynamicIntArrayGetRecycleLimit(void)
+ * @brief 기본 할당자의 쓰레드별 재사용 캐시가 크기 등급마다 보관하는 최대 개수를 반환하는 함수
+ * @return 최대 보관 개수 반환
  */
-dynamicIntArray_t *dynamicIntArrayAppend(dynamicIntArray_t *array, int datum)
+size_t dynamicIntArrayGetRecycleLimit(void)
+{
+	return recycleLimit;
+}
+
+/**
+ * @fn int dynamicIntArrayGetRecycleStats(dynamicIntArrayRecycleStats_t *stats)
+ * @brief 호출한 쓰레드의 재사용 캐시 통계를 반환하는 함수
+ * @param stats 통계를 저장할 구조체 포인터(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayGetRecycleStats(dynamicIntArrayRecycleStats_t *stats)
 {
-	array = dynamicIntArrayResize(array, ++(array->size), YES);
-	if(checkObjectNull(array, "메모리 재생성 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayAppend)") == YES)
+	if(checkObjectNull(stats, "메모리 참조 실패, 통계 구조체 포인터가 NULL. (dynamicIntArrayGetRecycleStats)") == YES)
 	{
-		--(array->size);
-		return NULL;
+		return FAIL;
 	}
 
-	if(dynamicIntArraySetElement(array, (array->size - 1), datum) == FAIL)
+	const recycleCache_t *cache = &recycleThreadCache;
+	stats->hits = cache->hits;
+	stats->misses = cache->misses;
+	stats->recycled = cache->recycled;
+	stats->released = cache->released;
+	stats->cachedHeaders = cache->counts[RECYCLE_HEADER_CLASS];
+	stats->cachedBuffers = 0;
+	stats->cachedBytes = cache->counts[RECYCLE_HEADER_CLASS] * sizeof(dynamicIntArray_t);
+
+	int sizeClass = 0;
+	for( ; sizeClass < DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT; sizeClass++)
 	{
-		printMsg("배열 저장 오류. dynamicIntArraySetElement 동작 실패. (dynamicIntArrayAppend)", DEBUG, 0);
-		return NULL;
+		stats->cachedBuffers += cache->counts[sizeClass];
+		stats->cachedBytes += cache->counts[sizeClass] * getRecycleClassSize(sizeClass);
 	}
 
-	return array;
+	return SUCCESS;
 }
 
 /**
- * @fn dynamicIntArray_t *dynamicIntArrayInsertAt(dynamicIntArray_t *array, int index, int datum)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 특정 값을 추가하는 함수
+ * @fn size_t dynamicIntArrayTrimRecycle(void)
+ * @brief 호출한 쓰레드의 재사용 캐시에 보관 중인 메모리를 모두 해제하는 함수
+ * 쓰레드가 끝날 때는 자동으로 해제되므로, 오래 실행되는 쓰레드에서 메모리를 돌려줄 때 사용한다.
+ * @return 해제한 전체 크기 반환 (바이트)
+ */
+size_t dynamicIntArrayTrimRecycle(void)
+{
+	return trimRecycleCache(&recycleThreadCache);
+}
+
+/**
+ * @fn int dynamicIntArrayClear(dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체의 동적 배열 관련 멤버 변수들을 모두 0 으로 설정하는 함수
  * @param array 동적 배열 관리 구조체 포인터(입력)
- * @param index 지정할 인덱스(입력)
- * @param datum 추가할 특정 값(입력)
- * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-dynamicIntArray_t *dynamicIntArrayInsertAt(dynamicIntArray_t *array, int index, int datum)
+int dynamicIntArrayClear(dynamicIntArray_t *array)
 {
-	if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+	int *arrayData = dynamicIntArrayGetArrayPtr(array);
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayClear)") == YES)
 	{
-		printMsg("Insert at 실패. 인덱스 오류. (dynamicIntArrayInsertAt)", ERROR, 0);
-		return NULL;
+		return FAIL;
 	}
 
-	int size = array->size;
-	int tempArraySize = size - index;
-	dynamicIntArray_t tempArray;
-
-	if(dynamicIntArrayInitialize(&tempArray, tempArraySize) == FAIL)
+	size_t size = array->size;
+	if(size == 0)
 	{
-		printMsg("동적 배열 관리 구조체 초기화 실패. (dynamicIntArrayInsertAt)", DEBUG, 0);
-		return NULL;
+		PRINT_MSG("동적 배열의 크기가 0. (dynamicIntArrayClear, size:%zu)", DEBUG, 1, size);
+		return FAIL;
 	}
 
-	if (dynamicIntArrayCopy(&tempArray, 0, array, index, tempArraySize) == FAIL)
+	if(prepareWrite(array, "dynamicIntArrayClear") == FAIL)
 	{
-		printMsg("배열 복사 오류. dynamicIntArrayCopy 동작 실패. (dynamicIntArrayInsertAt, array -> tempArray)", DEBUG, 0);
-		return NULL;
+		return FAIL;
 	}
 
-	array = dynamicIntArrayResize(array, ++(array->size), YES);
-	if(checkObjectNull(array, "메모리 재생성 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayInsertAt)") == YES)
-	{
-		--(array->size);
-		return NULL;
-	}
+	size_t totalSize = size * sizeof(int);
+	memset(array->data, 0, totalSize);
+	array->size = 0;
 
-	if (dynamicIntArrayCopy(array, (index + 1), &tempArray, 0, tempArraySize) == FAIL)
+	if(checkObjectNull(array->stringOfArray, NULL) == NO)
 	{
-		printMsg("배열 복사 오류. dynamicIntArrayCopy 동작 실패. (dynamicIntArrayInsertAt, tempArray -> array)", DEBUG, 0);
-		return NULL;
+		memset(array->stringOfArray, 0, strlen(array->stringOfArray));
 	}
 
-	if(dynamicIntArraySetElement(array, index, datum) == FAIL)
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayFinal(dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체의 멤버 변수의 동적으로 생성한 메모리는 해제하고 정적 변수는 0 으로 설정하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayFinal(dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayFinal)") == YES)
 	{
-		printMsg("배열 저장 오류. dynamicIntArraySetElement 동작 실패. (dynamicIntArrayInsertAt)", DEBUG, 0);
-		return NULL;
+		return FAIL;
 	}
 
-	if(dynamicIntArrayFinal(&tempArray) == FAIL)
+	releaseStorage(array);
+
+	if(checkObjectNull(array->stringOfArray, NULL) == NO)
 	{
-		printMsg("tempArray 내부 동적 배열 메모리 해제 실패. dynamicIntArrayFinal 실패. (dynamicIntArrayInsertAt)", DEBUG, 0);
-		return NULL;
+		array->allocator->deallocate(array->allocator->context, array->stringOfArray, array->stringCapacity);
+		array->stringOfArray = NULL;
+		array->stringCapacity = 0;
 	}
 
-	return array;
+	return SUCCESS;
+}
+
+/**
+ * @fn void dynamicIntArrayDelete(dynamicIntArray_t **array)
+ * @brief 동적 배열 관리 구조체의 생성한 메모리를 해제하는 함수
+ * @param array 동적 배열 관리 구조체 포인터 변수의 주소를 가지는 포인터(더블 포인터, 입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void dynamicIntArrayDelete(dynamicIntArray_t **array)
+{
+	if(dynamicIntArrayFinal(*array) == FAIL)
+	{
+		PRINT_MSG("동적 배열 관리 구조체 메모리 해제 실패. dynamicIntArrayFinal 실패. (dynamicIntArrayDelete, array:%p)", DEBUG, 1, *array);
+		return;
+	}
+
+	const dynamicIntArrayAllocator_t *allocator = (*array)->allocator;
+	allocator->deallocate(allocator->context, *array, sizeof(dynamicIntArray_t));
+	*array = NULL;
+}
+
+/**
+ * @fn int dynamicIntArraySetElement(dynamicIntArray_t *array, int index, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 특정 값을 저장하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param index 지정할 인덱스(입력)
+ * @param datum 저장할 특정 값(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArraySetElement(dynamicIntArray_t *array, int index, int datum)
+{
+	// 정상적인 접근은 함수 호출 없이 바로 검사하고, 실패한 경우에만 검사 함수들을 호출해서 원인을 출력한다.
+	if((array == NULL) || (index < 0) || ((size_t)index >= array->size) || (array->data == NULL) || (array->storageKind == STORAGE_MAPPED_READ_ONLY) || (array->storageKind == STORAGE_SHARED_READ_ONLY) || (array->cowBlock != NULL))
+	{
+		if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+		{
+			PRINT_MSG("Set 실패. 인덱스 오류. (dynamicIntArraySetElement)", ERROR, 0);
+			return FAIL;
+		}
+
+		if((checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArraySetElement)") == YES)
+			|| (prepareWrite(array, "dynamicIntArraySetElement") == FAIL))
+		{
+			return FAIL;
+		}
+	}
+
+	array->data[index] = datum;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArraySetElement64(dynamicIntArray_t *array, size_t index, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 특정 값을 저장하는 함수 (size_t 인덱스)
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param index 지정할 인덱스(입력)
+ * @param datum 저장할 특정 값(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArraySetElement64(dynamicIntArray_t *array, size_t index, int datum)
+{
+	// 정상적인 접근은 함수 호출 없이 바로 검사하고, 실패한 경우에만 검사 함수들을 호출해서 원인을 출력한다.
+	if((array == NULL) || (index >= array->size) || (array->data == NULL) || (array->storageKind == STORAGE_MAPPED_READ_ONLY) || (array->storageKind == STORAGE_SHARED_READ_ONLY) || (array->cowBlock != NULL))
+	{
+		if(dynamicIntArrayCheckBoundary64(array, index) == FAIL)
+		{
+			PRINT_MSG("Set 실패. 인덱스 오류. (dynamicIntArraySetElement64)", ERROR, 0);
+			return FAIL;
+		}
+
+		if((checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArraySetElement64)") == YES)
+			|| (prepareWrite(array, "dynamicIntArraySetElement64") == FAIL))
+		{
+			return FAIL;
+		}
+	}
+
+	array->data[index] = datum;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayGetElement(const dynamicIntArray_t *array, int index, int *isError)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 저장된 값을 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param index 지정할 인덱스(입력)
+ * @param isError 함수 실행 결과(출력, 함수 실행 성공 시 SUCCESS, 실패 시 FAIL 저장)
+ * @return 성공 시 지정한 인덱스에 저장된 값, 실패 시 NONE 반환
+ */
+int dynamicIntArrayGetElement(const dynamicIntArray_t *array, int index, int *isError)
+{
+	// 정상적인 접근은 함수 호출 없이 바로 검사하고, 실패한 경우에만 검사 함수들을 호출해서 원인을 출력한다.
+	if((array == NULL) || (index < 0) || ((size_t)index >= array->size) || (array->data == NULL))
+	{
+		if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+		{
+			PRINT_MSG("Get 실패. 인덱스 오류. (dynamicIntArrayGetElement)", ERROR, 0);
+			*isError = FAIL;
+			return NONE;
+		}
+
+		checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayGetElement)");
+		*isError = FAIL;
+		return NONE;
+	}
+
+	*isError = SUCCESS;
+	return array->data[index];
+}
+
+/**
+ * @fn int dynamicIntArrayGetElement64(const dynamicIntArray_t *array, size_t index, int *isError)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 저장된 값을 반환하는 함수 (size_t 인덱스)
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param index 지정할 인덱스(입력)
+ * @param isError 함수 실행 결과(출력, 함수 실행 성공 시 SUCCESS, 실패 시 FAIL 저장)
+ * @return 성공 시 지정한 인덱스에 저장된 값, 실패 시 NONE 반환
+ */
+int dynamicIntArrayGetElement64(const dynamicIntArray_t *array, size_t index, int *isError)
+{
+	// 정상적인 접근은 함수 호출 없이 바로 검사하고, 실패한 경우에만 검사 함수들을 호출해서 원인을 출력한다.
+	if((array == NULL) || (index >= array->size) || (array->data == NULL))
+	{
+		if(dynamicIntArrayCheckBoundary64(array, index) == FAIL)
+		{
+			PRINT_MSG("Get 실패. 인덱스 오류. (dynamicIntArrayGetElement64)", ERROR, 0);
+			*isError = FAIL;
+			return NONE;
+		}
+
+		checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayGetElement64)");
+		*isError = FAIL;
+		return NONE;
+	}
+
+	*isError = SUCCESS;
+	return array->data[index];
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayAppend(dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 끝에 새로운 값을 추가하는 함수
+ * 용량이 부족할 때만 용량을 배수로 늘려서 재할당한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param datum 추가할 특정 값(입력)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayAppend(dynamicIntArray_t *array, int datum)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayAppend)") == YES)
+	{
+		return NULL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayAppend") == FAIL)
+	{
+		return NULL;
+	}
+
+	if(growCapacity(array, (array->size + 1)) == FAIL)
+	{
+		PRINT_MSG("메모리 재생성 실패. growCapacity 실패. (dynamicIntArrayAppend)", DEBUG, 0);
+		return NULL;
+	}
+	array->data[(array->size)++] = datum;
+
+	return array;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayAppendN(dynamicIntArray_t *array, const int *src, int n)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 끝에 여러 개의 값을 한 번에 추가하는 함수
+ * 필요한 용량을 한 번만 확보하고 한 번의 메모리 복사로 추가한다.
+ * src 가 같은 동적 배열의 내부를 가리켜도 된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param src 추가할 값들이 저장된 배열(입력, 읽기 전용)
+ * @param n 추가할 값의 개수(입력)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayAppendN(dynamicIntArray_t *array, const int *src, int n)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayAppendN)") == YES)
+	{
+		return NULL;
+	}
+
+	if(checkObjectNull(src, "메모리 참조 실패, 추가할 배열이 NULL. (dynamicIntArrayAppendN)") == YES)
+	{
+		return NULL;
+	}
+
+	size_t size = array->size;
+	if(n <= 0)
+	{
+		PRINT_MSG("Append 실패. 추가할 개수 오류. (dynamicIntArrayAppendN, n:%d, size:%zu)", ERROR, 2, n, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayAppendN") == FAIL)
+	{
+		return NULL;
+	}
+
+	// 추가할 값들이 같은 동적 배열 내부에 있으면 재할당 이후의 위치를 다시 계산해야 하므로 오프셋을 기억한다.
+	int isAliased = NO;
+	size_t srcOffset = 0;
+	if(((uintptr_t)src >= (uintptr_t)array->data) && ((uintptr_t)src < (uintptr_t)(array->data + size)))
+	{
+		isAliased = YES;
+		srcOffset = (size_t)(src - array->data);
+	}
+
+	if(growCapacity(array, (size + (size_t)n)) == FAIL)
+	{
+		PRINT_MSG("메모리 재생성 실패. growCapacity 실패. (dynamicIntArrayAppendN)", DEBUG, 0);
+		return NULL;
+	}
+
+	if(isAliased == YES)
+	{
+		src = array->data + srcOffset;
+	}
+
+	memcpy(array->data + size, src, (size_t)n * sizeof(int));
+	array->size = size + (size_t)n;
+
+	return array;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayAppendArray(dynamicIntArray_t *dst, const dynamicIntArray_t *src)
+ * @brief 하나의 동적 배열 관리 구조체의 모든 원소를 다른 동적 배열 관리 구조체의 동적 배열 끝에 추가하는 함수
+ * dst 와 src 가 같아도 된다.
+ * @param dst 원소가 추가될 동적 배열 관리 구조체 포인터(입력)
+ * @param src 추가할 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 dst 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayAppendArray(dynamicIntArray_t *dst, const dynamicIntArray_t *src)
+{
+	size_t srcSize = dynamicIntArrayGetSize64(src);
+	if(srcSize == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayAppendArray, src:%p)", DEBUG, 1, src);
+		return NULL;
+	}
+
+	// AppendN 은 int 개수를 받으므로 나눠서 추가한다. (dst 와 src 가 같으면 처음 크기만큼만 추가)
+	size_t srcOffset = 0;
+	while(srcOffset < srcSize)
+	{
+		size_t n = srcSize - srcOffset;
+		if(n > (size_t)INT_MAX) n = (size_t)INT_MAX;
+
+		if(dynamicIntArrayAppendN(dst, src->data + srcOffset, (int)n) == NULL)
+		{
+			PRINT_MSG("dynamicIntArrayAppendN 실패. (dynamicIntArrayAppendArray, offset:%zu)", DEBUG, 1, srcOffset);
+			return NULL;
+		}
+		srcOffset += n;
+	}
+
+	return dst;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayInsertAt(dynamicIntArray_t *array, int index, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 특정 값을 추가하는 함수
+ * 용량이 부족할 때만 용량을 배수로 늘려서 재할당하고, 지정한 인덱스 이후의 원소들은 제자리에서 한 칸씩 뒤로 이동한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param index 지정할 인덱스(입력)
+ * @param datum 추가할 특정 값(입력)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayInsertAt(dynamicIntArray_t *array, int index, int datum)
+{
+	if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+	{
+		PRINT_MSG("Insert at 실패. 인덱스 오류. (dynamicIntArrayInsertAt)", ERROR, 0);
+		return NULL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayInsertAt") == FAIL)
+	{
+		return NULL;
+	}
+
+	size_t size = array->size;
+	if(growCapacity(array, (size + 1)) == FAIL)
+	{
+		PRINT_MSG("메모리 재생성 실패. growCapacity 실패. (dynamicIntArrayInsertAt)", DEBUG, 0);
+		return NULL;
+	}
+
+	int *arrayData = array->data;
+	memmove(arrayData + index + 1, arrayData + index, (size - (size_t)index) * sizeof(int));
+	arrayData[index] = datum;
+	array->size = size + 1;
+
+	return array;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayInsertRange(dynamicIntArray_t *array, int index, const int *src, int n)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 여러 개의 값을 한 번에 추가하는 함수
+ * 지정한 인덱스 이후의 원소들은 제자리에서 한 번에 n 칸 뒤로 이동한다.
+ * 인덱스가 배열의 크기와 같으면 배열의 끝에 추가한다.
+ * src 가 같은 동적 배열의 내부를 가리켜도 된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param index 지정할 인덱스(입력, 0 ~ size)
+ * @param src 추가할 값들이 저장된 배열(입력, 읽기 전용)
+ * @param n 추가할 값의 개수(입력)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayInsertRange(dynamicIntArray_t *array, int index, const int *src, int n)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayInsertRange)") == YES)
+	{
+		return NULL;
+	}
+
+	if(checkObjectNull(src, "메모리 참조 실패, 추가할 배열이 NULL. (dynamicIntArrayInsertRange)") == YES)
+	{
+		return NULL;
+	}
+
+	size_t size = array->size;
+	if((index < 0) || ((size_t)index > size))
+	{
+		PRINT_MSG("Insert range 실패. 인덱스 오류. (dynamicIntArrayInsertRange, index:%d, range:0~%zu)", ERROR, 2, index, size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return NULL;
+	}
+
+	if(n <= 0)
+	{
+		PRINT_MSG("Insert range 실패. 추가할 개수 오류. (dynamicIntArrayInsertRange, n:%d, size:%zu)", ERROR, 2, n, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayInsertRange") == FAIL)
+	{
+		return NULL;
+	}
+
+	// 추가할 값들이 같은 동적 배열 내부에 있으면 재할당과 이동 이후의 위치를 다시 계산해야 하므로 오프셋을 기억한다.
+	int isAliased = NO;
+	size_t srcOffset = 0;
+	if(((uintptr_t)src >= (uintptr_t)array->data) && ((uintptr_t)src < (uintptr_t)(array->data + size)))
+	{
+		isAliased = YES;
+		srcOffset = (size_t)(src - array->data);
+	}
+
+	size_t insertIndex = (size_t)index;
+	size_t count = (size_t)n;
+	if(growCapacity(array, (size + count)) == FAIL)
+	{
+		PRINT_MSG("메모리 재생성 실패. growCapacity 실패. (dynamicIntArrayInsertRange)", DEBUG, 0);
+		return NULL;
+	}
+
+	int *arrayData = array->data;
+	memmove(arrayData + insertIndex + count, arrayData + insertIndex, (size - insertIndex) * sizeof(int));
+
+	if(isAliased == YES)
+	{
+		// 인덱스 앞쪽에 있던 값들은 그대로, 뒤쪽에 있던 값들은 n 칸 이동한 위치에서 복사한다.
+		size_t countBeforeIndex = (insertIndex > srcOffset) ? (insertIndex - srcOffset) : 0;
+		if(countBeforeIndex > count) countBeforeIndex = count;
+
+		memcpy(arrayData + insertIndex, arrayData + srcOffset, countBeforeIndex * sizeof(int));
+		memcpy(arrayData + insertIndex + countBeforeIndex, arrayData + srcOffset + countBeforeIndex + count, (count - countBeforeIndex) * sizeof(int));
+	}
+	else
+	{
+		memcpy(arrayData + insertIndex, src, count * sizeof(int));
+	}
+
+	array->size = size + count;
+	return array;
 }
 
 /**
  * @fn dynamicIntArray_t *dynamicIntArrayRemoveAt(dynamicIntArray_t *array, int index)
  * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스에 저장된 값을 삭제하는 함수
+ * 지정한 인덱스 이후의 원소들은 제자리에서 한 칸씩 앞으로 이동한다.
+ * 크기가 용량의 1/DYNAMIC_INT_ARRAY_SHRINK_DIVISOR 이하로 줄어들 때만 용량을 줄여서 재할당한다.
  * @param array 동적 배열 관리 구조체 포인터(입력)
  * @param index 지정할 인덱스(입력)
  * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
  */
-dynamicIntArray_t *dynamicIntArrayRemoveAt(dynamicIntArray_t *array, int index)
+dynamicIntArray_t *dynamicIntArrayRemoveAt(dynamicIntArray_t *array, int index)
+{
+	if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+	{
+		PRINT_MSG("Remove at 실패. 인덱스 오류. (dynamicIntArrayRemoveAt)", ERROR, 0);
+		return NULL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayRemoveAt") == FAIL)
+	{
+		return NULL;
+	}
+
+	int *arrayData = array->data;
+	size_t size = array->size;
+	memmove(arrayData + index, arrayData + index + 1, (size - ((size_t)index + 1)) * sizeof(int));
+	array->size = size - 1;
+
+	// 삭제는 이미 끝났으므로 용량을 줄이지 못하면 기존 용량을 그대로 사용한다.
+	if(shrinkCapacity(array) == FAIL)
+	{
+		PRINT_MSG("용량 축소 실패. 기존 용량 유지. (dynamicIntArrayRemoveAt, capacity:%zu)", DEBUG, 1, array->capacity);
+	}
+
+	return array;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayRemoveRange(dynamicIntArray_t *array, int index, int n)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스부터 여러 개의 값을 한 번에 삭제하는 함수
+ * 삭제한 범위 이후의 원소들은 제자리에서 한 번에 n 칸 앞으로 이동한다.
+ * 크기가 용량의 1/DYNAMIC_INT_ARRAY_SHRINK_DIVISOR 이하로 줄어들 때만 용량을 줄여서 재할당한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param index 삭제를 시작할 인덱스(입력)
+ * @param n 삭제할 값의 개수(입력)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayRemoveRange(dynamicIntArray_t *array, int index, int n)
+{
+	if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+	{
+		PRINT_MSG("Remove range 실패. 인덱스 오류. (dynamicIntArrayRemoveRange)", ERROR, 0);
+		return NULL;
+	}
+
+	size_t size = array->size;
+	if((n <= 0) || ((size_t)n > (size - (size_t)index)))
+	{
+		PRINT_MSG("Remove range 실패. 삭제할 개수 오류. (dynamicIntArrayRemoveRange, index:%d, n:%d, size:%zu)", ERROR, 3, index, n, size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return NULL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayRemoveRange") == FAIL)
+	{
+		return NULL;
+	}
+
+	int *arrayData = array->data;
+	memmove(arrayData + index, arrayData + index + n, (size - ((size_t)index + (size_t)n)) * sizeof(int));
+	array->size = size - (size_t)n;
+
+	// 삭제는 이미 끝났으므로 용량을 줄이지 못하면 기존 용량을 그대로 사용한다.
+	if(shrinkCapacity(array) == FAIL)
+	{
+		PRINT_MSG("용량 축소 실패. 기존 용량 유지. (dynamicIntArrayRemoveRange, capacity:%zu)", DEBUG, 1, array->capacity);
+	}
+
+	return array;
+}
+
+/**
+ * @fn int dynamicIntArrayIndexOf(const dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 첫 번째 인덱스를 반환하는 함수
+ * CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 검색된 인덱스, 검색 실패 시 UNKNOWN, 내부 함수 호출 실패 또는 인덱스가 int 범위를 넘으면 FAIL 반환
+ */
+int dynamicIntArrayIndexOf(const dynamicIntArray_t *array, int datum)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayIndexOf)") == YES)
+	{
+		return FAIL;
+	}
+
+	return narrowIndex(dynamicIntArrayIndexOf64(array, datum), "dynamicIntArrayIndexOf");
+}
+
+/**
+ * @fn size_t dynamicIntArrayIndexOf64(const dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 첫 번째 인덱스를 반환하는 함수 (size_t 인덱스)
+ * CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 검색된 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayIndexOf64(const dynamicIntArray_t *array, int datum)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayIndexOf64, array:%p)", DEBUG, 1, array);
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return simdKernels.indexOf(array->data, size, datum);
+}
+
+/**
+ * @fn int dynamicIntArrayLastIndexOf(const dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 마지막 인덱스를 반환하는 함수
+ * CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 검색된 인덱스, 검색 실패 시 UNKNOWN, 내부 함수 호출 실패 또는 인덱스가 int 범위를 넘으면 FAIL 반환
+ */
+int dynamicIntArrayLastIndexOf(const dynamicIntArray_t *array, int datum)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayLastIndexOf)") == YES)
+	{
+		return FAIL;
+	}
+
+	return narrowIndex(dynamicIntArrayLastIndexOf64(array, datum), "dynamicIntArrayLastIndexOf");
+}
+
+/**
+ * @fn size_t dynamicIntArrayLastIndexOf64(const dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 마지막 인덱스를 반환하는 함수 (size_t 인덱스)
+ * CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 검색된 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayLastIndexOf64(const dynamicIntArray_t *array, int datum)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayLastIndexOf64, array:%p)", DEBUG, 1, array);
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return simdKernels.lastIndexOf(array->data, size, datum);
+}
+
+/**
+ * @fn int dynamicIntArrayCount(const dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 개수를 반환하는 함수
+ * CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 지정한 값의 개수, 내부 함수 호출 실패 또는 개수가 int 범위를 넘으면 FAIL 반환
+ */
+int dynamicIntArrayCount(const dynamicIntArray_t *array, int datum)
+{
+	size_t count = dynamicIntArrayCount64(array, datum);
+	if(count == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayCount64 실패. (dynamicIntArrayCount, array:%p)", DEBUG, 1, array);
+		return FAIL;
+	}
+
+	if(count > (size_t)INT_MAX)
+	{
+		PRINT_MSG("int 로 표현할 수 없는 개수. 64 비트 함수를 사용해야 함. (dynamicIntArrayCount, count:%zu)", ERROR, 1, count);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	return (int)count;
+}
+
+/**
+ * @fn size_t dynamicIntArrayCount64(const dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 개수를 반환하는 함수 (size_t 개수)
+ * CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 지정한 값의 개수, 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayCount64(const dynamicIntArray_t *array, int datum)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayCount64, array:%p)", DEBUG, 1, array);
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return simdKernels.count(array->data, size, datum);
+}
+
+/**
+ * @fn int dynamicIntArrayFind(const dynamicIntArray_t *array, compareInt1Param_f func)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 조건 함수의 조건과 일치하는 값의 첫 번째 인덱스를 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @return 성공 시 검색된 인덱스, 검색 실패 시 UNKNOWN, 내부 함수 호출 실패 또는 인덱스가 int 범위를 넘으면 FAIL 반환
+ */
+int dynamicIntArrayFind(const dynamicIntArray_t *array, compareInt1Param_f func)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayFind)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(func == NULL)
+	{
+		PRINT_MSG("메모리 참조 실패, 조건 함수가 NULL. (dynamicIntArrayFind)", DEBUG, 0);
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	return narrowIndex(dynamicIntArrayFind64(array, func), "dynamicIntArrayFind");
+}
+
+/**
+ * @fn size_t dynamicIntArrayFind64(const dynamicIntArray_t *array, compareInt1Param_f func)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 조건 함수의 조건과 일치하는 값의 첫 번째 인덱스를 반환하는 함수 (size_t 인덱스)
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @return 성공 시 검색된 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayFind64(const dynamicIntArray_t *array, compareInt1Param_f func)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayFind64, array:%p)", DEBUG, 1, array);
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if(func == NULL)
+	{
+		PRINT_MSG("메모리 참조 실패, 조건 함수가 NULL. (dynamicIntArrayFind64)", DEBUG, 0);
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	const int *arrayData = array->data;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < size; loopIndex++)
+	{
+		if (func(arrayData[loopIndex]) == YES)
+		{
+			return loopIndex;
+		}
+	}
+
+	return DYNAMIC_INT_ARRAY_NPOS;
+}
+
+/**
+ * @fn size_t dynamicIntArrayFindIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+ * @brief 동적 배열에서 문맥을 함께 전달받는 조건 함수의 조건과 일치하는 값의 첫 번째 인덱스를 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @param context 조건 함수에 그대로 전달할 사용자 정의 데이터(입력, NULL 가능)
+ * @return 성공 시 검색된 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayFindIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+{
+	if(checkPredicateCall(array, func, "dynamicIntArrayFindIf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return findIfFrom(array->data, 0, array->size, func, context);
+}
+
+/**
+ * @fn size_t dynamicIntArrayFindLastIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+ * @brief 동적 배열에서 문맥을 함께 전달받는 조건 함수의 조건과 일치하는 값의 마지막 인덱스를 반환하는 함수
+ * 끝에서부터 검사하므로 일치하는 값을 찾으면 바로 반환한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @param context 조건 함수에 그대로 전달할 사용자 정의 데이터(입력, NULL 가능)
+ * @return 성공 시 검색된 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayFindLastIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+{
+	if(checkPredicateCall(array, func, "dynamicIntArrayFindLastIf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	const int *arrayData = array->data;
+	size_t loopIndex = array->size;
+
+	for (; loopIndex > 0; loopIndex--)
+	{
+		if (func(arrayData[loopIndex - 1], context) == YES)
+		{
+			return loopIndex - 1;
+		}
+	}
+
+	return DYNAMIC_INT_ARRAY_NPOS;
+}
+
+/**
+ * @fn size_t dynamicIntArrayFindAllIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context, size_t *indices, size_t capacity)
+ * @brief 동적 배열에서 문맥을 함께 전달받는 조건 함수의 조건과 일치하는 모든 값의 인덱스를 출력 배열에 저장하는 함수
+ * 한 번만 순회하고 메모리를 할당하지 않는다.
+ * 출력 배열이 가득 차도 끝까지 세므로, 반환값이 capacity 보다 크면 그만큼의 출력 배열로 다시 호출하면 된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @param context 조건 함수에 그대로 전달할 사용자 정의 데이터(입력, NULL 가능)
+ * @param indices 일치하는 인덱스들을 오름차순으로 저장할 출력 배열(출력, capacity 가 0 이면 NULL 가능)
+ * @param capacity 출력 배열에 저장할 수 있는 인덱스 개수(입력)
+ * @return 성공 시 일치하는 값의 전체 개수(capacity 보다 클 수 있음), 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayFindAllIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context, size_t *indices, size_t capacity)
+{
+	if(checkPredicateCall(array, func, "dynamicIntArrayFindAllIf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if((capacity > 0) && (checkObjectNull(indices, "메모리 참조 실패, 출력 배열이 NULL. (dynamicIntArrayFindAllIf)") == YES))
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	const int *arrayData = array->data;
+	size_t size = array->size;
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < size; loopIndex++)
+	{
+		if (func(arrayData[loopIndex], context) == YES)
+		{
+			if (count < capacity)
+			{
+				indices[count] = loopIndex;
+			}
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * @fn size_t dynamicIntArrayCountIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+ * @brief 동적 배열에서 문맥을 함께 전달받는 조건 함수의 조건과 일치하는 값의 개수를 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @param context 조건 함수에 그대로 전달할 사용자 정의 데이터(입력, NULL 가능)
+ * @return 성공 시 일치하는 값의 개수, 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayCountIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+{
+	if(checkPredicateCall(array, func, "dynamicIntArrayCountIf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	const int *arrayData = array->data;
+	size_t size = array->size;
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < size; loopIndex++)
+	{
+		count += (func(arrayData[loopIndex], context) == YES) ? 1 : 0;
+	}
+
+	return count;
+}
+
+/**
+ * @fn size_t dynamicIntArrayRemoveIf(dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+ * @brief 동적 배열에서 문맥을 함께 전달받는 조건 함수의 조건과 일치하는 값들을 모두 삭제하는 함수
+ * 남는 원소들의 순서를 유지하면서 한 번의 순회로 제자리에서 앞으로 모으고(stable compaction), 조건 함수는 원소마다 한 번씩만 호출한다.
+ * 첫 번째로 일치하는 값 이전의 원소는 옮기지 않고, 일치하는 값이 없으면 변경하지 않는다.
+ * 크기가 용량의 1/DYNAMIC_INT_ARRAY_SHRINK_DIVISOR 이하로 줄어들 때만 용량을 줄여서 재할당한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param func 지정한 조건 함수(입력)
+ * @param context 조건 함수에 그대로 전달할 사용자 정의 데이터(입력, NULL 가능)
+ * @return 성공 시 삭제한 값의 개수, 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayRemoveIf(dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+{
+	if(checkPredicateCall(array, func, "dynamicIntArrayRemoveIf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	size_t size = array->size;
+	size_t writeIndex = findIfFrom(array->data, 0, size, func, context);
+	if(writeIndex == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		return 0;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayRemoveIf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	int *arrayData = array->data;
+	size_t loopIndex = writeIndex + 1;
+
+	for (; loopIndex < size; loopIndex++)
+	{
+		int datum = arrayData[loopIndex];
+		if (func(datum, context) != YES)
+		{
+			arrayData[writeIndex++] = datum;
+		}
+	}
+
+	array->size = writeIndex;
+
+	// 삭제는 이미 끝났으므로 용량을 줄이지 못하면 기존 용량을 그대로 사용한다.
+	if(shrinkCapacity(array) == FAIL)
+	{
+		PRINT_MSG("용량 축소 실패. 기존 용량 유지. (dynamicIntArrayRemoveIf, capacity:%zu)", DEBUG, 1, array->capacity);
+	}
+
+	return size - writeIndex;
+}
+
+/**
+ * @fn size_t dynamicIntArrayPartition(dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+ * @brief 동적 배열에서 문맥을 함께 전달받는 조건 함수의 조건과 일치하는 값들을 앞쪽으로, 나머지를 뒤쪽으로 모으는 함수
+ * 한 번의 순회로 제자리에서 맞바꾸고, 조건 함수는 원소마다 한 번씩만 호출한다.
+ * 일치하는 값들은 원래 순서를 유지하지만 나머지 값들의 순서는 유지되지 않는다.
+ * 첫 번째로 일치하지 않는 값 이전의 원소는 옮기지 않고, 옮길 원소가 없으면 변경하지 않는다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param func 지정한 조건 함수(입력)
+ * @param context 조건 함수에 그대로 전달할 사용자 정의 데이터(입력, NULL 가능)
+ * @return 성공 시 일치하는 값의 개수(나머지 값들이 시작하는 인덱스), 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayPartition(dynamicIntArray_t *array, compareIntWithContext_f func, void *context)
+{
+	if(checkPredicateCall(array, func, "dynamicIntArrayPartition") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	const int *arrayData = array->data;
+	size_t size = array->size;
+	size_t boundary = 0;
+
+	// 앞쪽에 이미 모여 있는 일치하는 값들은 읽기만 한다.
+	while ((boundary < size) && (func(arrayData[boundary], context) == YES))
+	{
+		boundary++;
+	}
+
+	if(boundary == size)
+	{
+		return boundary;
+	}
+
+	// boundary 의 값은 일치하지 않으므로 그 다음부터 옮길 값을 찾는다.
+	size_t matchIndex = findIfFrom(arrayData, boundary + 1, size, func, context);
+	if(matchIndex == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		return boundary;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayPartition") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	// [0, boundary) 는 일치하는 값, [boundary, loopIndex) 는 일치하지 않는 값이다.
+	int *writableData = array->data;
+	size_t loopIndex = matchIndex;
+
+	for (; loopIndex < size; loopIndex++)
+	{
+		if ((loopIndex == matchIndex) || (func(writableData[loopIndex], context) == YES))
+		{
+			int temp = writableData[boundary];
+			writableData[boundary++] = writableData[loopIndex];
+			writableData[loopIndex] = temp;
+		}
+	}
+
+	return boundary;
+}
+
+/**
+ * @fn int dynamicIntArrayPredicateCompile(const dynamicIntArrayPredicate_t *predicate, dynamicIntArrayPredicateProgram_t *program)
+ * @brief 선언적 조건 서술자를 SIMD 커널이 평가하는 후위 표기법 단계 목록으로 컴파일하는 함수
+ * 비교 연산들은 같음, 작음, 큼, 구간, 비트 비교 단계로 바꾸고, 경계값 때문에 항상 참이거나 거짓인 비교는 상수 단계로 바꾼다.
+ * 컴파일한 조건은 변경하지 않으므로 여러 쓰레드에서 함께 사용할 수 있다.
+ * @param predicate 조건 서술자 트리의 루트(입력, 읽기 전용)
+ * @param program 컴파일한 조건을 저장할 구조체 포인터(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환 (알 수 없는 연산, 하위 조건 누락, 단계 수 초과)
+ */
+int dynamicIntArrayPredicateCompile(const dynamicIntArrayPredicate_t *predicate, dynamicIntArrayPredicateProgram_t *program)
+{
+	if(checkObjectNull(program, "메모리 참조 실패, 컴파일한 조건 구조체 포인터가 NULL. (dynamicIntArrayPredicateCompile)") == YES)
+	{
+		return FAIL;
+	}
+
+	program->stepCount = 0;
+	if(compilePredicateNode(predicate, program, 0) == FAIL)
+	{
+		PRINT_MSG("조건 서술자 컴파일 실패. (dynamicIntArrayPredicateCompile)", ERROR, 0);
+		program->stepCount = 0;
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn size_t dynamicIntArrayFindWhere(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 동적 배열에서 컴파일한 조건과 일치하는 값의 첫 번째 인덱스를 반환하는 함수
+ * 원소마다 조건 함수를 호출하지 않고, CPU 에 맞게 선택된 SIMD 조건 커널이 벡터 단위로 만든 비트 마스크로 검색한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param program dynamicIntArrayPredicateCompile 로 컴파일한 조건(입력, 읽기 전용)
+ * @return 성공 시 검색된 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayFindWhere(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program)
+{
+	if(checkPredicateProgram(array, program, "dynamicIntArrayFindWhere") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return simdKernels.findWhere(array->data, array->size, program);
+}
+
+/**
+ * @fn size_t dynamicIntArrayCountWhere(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 동적 배열에서 컴파일한 조건과 일치하는 값의 개수를 반환하는 함수
+ * CPU 에 맞게 선택된 SIMD 조건 커널이 벡터 단위로 만든 비트 마스크로 센다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param program dynamicIntArrayPredicateCompile 로 컴파일한 조건(입력, 읽기 전용)
+ * @return 성공 시 일치하는 값의 개수, 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayCountWhere(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program)
+{
+	if(checkPredicateProgram(array, program, "dynamicIntArrayCountWhere") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return simdKernels.countWhere(array->data, array->size, program);
+}
+
+/**
+ * @fn size_t dynamicIntArrayFilterWhere(const dynamicIntArray_t *src, const dynamicIntArrayPredicateProgram_t *program, dynamicIntArray_t *dst)
+ * @brief 원본 동적 배열에서 컴파일한 조건과 일치하는 값들을 순서대로 대상 동적 배열의 끝에 추가하는 함수
+ * CPU 에 맞게 선택된 SIMD 조건 커널이 만든 비트 마스크로 일치하는 원소들만 연속해서 저장(compress store)한다.
+ * 대상 동적 배열의 용량은 DYNAMIC_INT_ARRAY_FILTER_CHUNK_SIZE 개 단위로 용량 증가 정책에 따라 확보한다.
+ * @param src 원본 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param program dynamicIntArrayPredicateCompile 로 컴파일한 조건(입력, 읽기 전용)
+ * @param dst 대상 동적 배열 관리 구조체 포인터(출력, src 와 달라야 함)
+ * @return 성공 시 추가한 값의 개수, 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환 (실패 전에 처리한 구간의 값들은 추가되어 있음)
+ */
+size_t dynamicIntArrayFilterWhere(const dynamicIntArray_t *src, const dynamicIntArrayPredicateProgram_t *program, dynamicIntArray_t *dst)
+{
+	if((checkPredicateProgram(src, program, "dynamicIntArrayFilterWhere") == FAIL)
+		|| (checkObjectNull(dst, "메모리 참조 실패, 대상 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayFilterWhere)") == YES))
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if(dst == src)
+	{
+		PRINT_MSG("Filter 실패. 원본과 대상이 같은 동적 배열. (dynamicIntArrayFilterWhere)", ERROR, 0);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if(prepareWrite(dst, "dynamicIntArrayFilterWhere") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	size_t size = src->size;
+	size_t oldSize = dst->size;
+	size_t loopIndex = 0;
+
+	for(; loopIndex < size; loopIndex += DYNAMIC_INT_ARRAY_FILTER_CHUNK_SIZE)
+	{
+		size_t chunkSize = ((size - loopIndex) < DYNAMIC_INT_ARRAY_FILTER_CHUNK_SIZE) ? (size - loopIndex) : DYNAMIC_INT_ARRAY_FILTER_CHUNK_SIZE;
+
+		// 필터 커널은 원소 개수만큼의 출력 공간을 요구하므로 구간마다 최대 개수만큼 확보한다.
+		if(growCapacity(dst, dst->size + chunkSize) == FAIL)
+		{
+			PRINT_MSG("메모리 재생성 실패. growCapacity 실패. (dynamicIntArrayFilterWhere)", DEBUG, 0);
+			return DYNAMIC_INT_ARRAY_NPOS;
+		}
+
+		dst->size += simdKernels.filterWhere(src->data + loopIndex, chunkSize, program, dst->data + dst->size);
+	}
+
+	return dst->size - oldSize;
+}
+
+/**
+ * @fn int dynamicIntArraySum(const dynamicIntArray_t *array, int64_t *sum)
+ * @brief 동적 배열의 모든 원소의 합을 구하는 함수
+ * int 범위를 넘는 합도 64 비트로 누적하므로 넘치지 않는다. 구간의 합은 뷰를 만든 뒤 dynamicIntArrayViewSum 을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param sum 원소들의 합(출력, 빈 동적 배열이면 0)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArraySum(const dynamicIntArray_t *array, int64_t *sum)
+{
+	dynamicIntArrayView_t view;
+
+	if(initializeWholeArrayView(array, &view, "dynamicIntArraySum") == FAIL)
+	{
+		return FAIL;
+	}
+
+	return dynamicIntArrayViewSum(&view, sum);
+}
+
+/**
+ * @fn int dynamicIntArrayMin(const dynamicIntArray_t *array, int *min)
+ * @brief 동적 배열의 최솟값을 구하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param min 최솟값(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 동적 배열이면 FAIL 반환
+ */
+int dynamicIntArrayMin(const dynamicIntArray_t *array, int *min)
+{
+	dynamicIntArrayView_t view;
+
+	if(initializeWholeArrayView(array, &view, "dynamicIntArrayMin") == FAIL)
+	{
+		return FAIL;
+	}
+
+	return dynamicIntArrayViewMin(&view, min);
+}
+
+/**
+ * @fn int dynamicIntArrayMax(const dynamicIntArray_t *array, int *max)
+ * @brief 동적 배열의 최댓값을 구하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param max 최댓값(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 동적 배열이면 FAIL 반환
+ */
+int dynamicIntArrayMax(const dynamicIntArray_t *array, int *max)
+{
+	dynamicIntArrayView_t view;
+
+	if(initializeWholeArrayView(array, &view, "dynamicIntArrayMax") == FAIL)
+	{
+		return FAIL;
+	}
+
+	return dynamicIntArrayViewMax(&view, max);
+}
+
+/**
+ * @fn int dynamicIntArrayMinMax(const dynamicIntArray_t *array, int *min, int *max)
+ * @brief 동적 배열의 최솟값과 최댓값을 한 번의 순회로 함께 구하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param min 최솟값(출력)
+ * @param max 최댓값(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 동적 배열이면 FAIL 반환
+ */
+int dynamicIntArrayMinMax(const dynamicIntArray_t *array, int *min, int *max)
+{
+	dynamicIntArrayView_t view;
+
+	if(initializeWholeArrayView(array, &view, "dynamicIntArrayMinMax") == FAIL)
+	{
+		return FAIL;
+	}
+
+	return dynamicIntArrayViewMinMax(&view, min, max);
+}
+
+/**
+ * @fn size_t dynamicIntArrayArgMin(const dynamicIntArray_t *array)
+ * @brief 동적 배열에서 최솟값을 가진 첫 번째 원소의 인덱스를 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 최솟값의 첫 번째 인덱스, 실패 또는 빈 동적 배열이면 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayArgMin(const dynamicIntArray_t *array)
+{
+	dynamicIntArrayView_t view;
+
+	if(initializeWholeArrayView(array, &view, "dynamicIntArrayArgMin") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return dynamicIntArrayViewArgMin(&view);
+}
+
+/**
+ * @fn size_t dynamicIntArrayArgMax(const dynamicIntArray_t *array)
+ * @brief 동적 배열에서 최댓값을 가진 첫 번째 원소의 인덱스를 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 최댓값의 첫 번째 인덱스, 실패 또는 빈 동적 배열이면 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayArgMax(const dynamicIntArray_t *array)
+{
+	dynamicIntArrayView_t view;
+
+	if(initializeWholeArrayView(array, &view, "dynamicIntArrayArgMax") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return dynamicIntArrayViewArgMax(&view);
+}
+
+/**
+ * @fn int dynamicIntArrayMean(const dynamicIntArray_t *array, double *mean)
+ * @brief 동적 배열의 모든 원소의 평균을 구하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param mean 원소들의 평균(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 동적 배열이면 FAIL 반환
+ */
+int dynamicIntArrayMean(const dynamicIntArray_t *array, double *mean)
+{
+	dynamicIntArrayView_t view;
+
+	if(initializeWholeArrayView(array, &view, "dynamicIntArrayMean") == FAIL)
+	{
+		return FAIL;
+	}
+
+	return dynamicIntArrayViewMean(&view, mean);
+}
+
+/**
+ * @fn int dynamicIntArrayReverse(dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 전체 원소들을 역순으로 저장하는 함수
+ * CPU 에 맞게 선택된 SIMD 역순 커널을 사용하여 제자리에서 처리한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayReverse(dynamicIntArray_t *array)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayReverse, array:%p)", DEBUG, 1, array);
+		return FAIL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayReverse") == FAIL)
+	{
+		return FAIL;
+	}
+
+	simdKernels.reverse(array->data, size);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayReverseRange(dynamicIntArray_t *array, int from, int n)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스부터 n 개의 원소들을 역순으로 저장하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param from 역순으로 저장할 범위의 시작 인덱스(입력)
+ * @param n 역순으로 저장할 원소 개수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayReverseRange(dynamicIntArray_t *array, int from, int n)
+{
+	if(dynamicIntArrayCheckBoundary(array, from) == FAIL)
+	{
+		PRINT_MSG("Reverse range 실패. 인덱스 오류. (dynamicIntArrayReverseRange)", ERROR, 0);
+		return FAIL;
+	}
+
+	size_t size = array->size;
+	if((n <= 0) || ((size_t)n > (size - (size_t)from)))
+	{
+		PRINT_MSG("Reverse range 실패. 역순으로 저장할 개수 오류. (dynamicIntArrayReverseRange, from:%d, n:%d, size:%zu)", ERROR, 3, from, n, size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayReverseRange") == FAIL)
+	{
+		return FAIL;
+	}
+
+	simdKernels.reverse(array->data + from, (size_t)n);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayRotate(dynamicIntArray_t *array, int k)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 원소들을 k 칸 회전하는 함수
+ * k 가 양수이면 뒤쪽(큰 인덱스)으로, 음수이면 앞쪽(작은 인덱스)으로 회전하며, 배열 끝을 넘어간 원소들은 반대편으로 돌아온다.
+ * 세 번의 역순 저장으로 처리하므로 추가 메모리를 할당하지 않는다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param k 회전할 칸 수(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayRotate(dynamicIntArray_t *array, int k)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayRotate, array:%p)", DEBUG, 1, array);
+		return FAIL;
+	}
+
+	if(size < 2)
+	{
+		return SUCCESS;
+	}
+
+	// 음수 k 는 같은 거리만큼 반대 방향으로 회전하는 것과 같다.
+	size_t shift = (size_t)((k >= 0) ? (long long)k : -(long long)k) % size;
+	if((k < 0) && (shift != 0))
+	{
+		shift = size - shift;
+	}
+
+	if(shift == 0)
+	{
+		return SUCCESS;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayRotate") == FAIL)
+	{
+		return FAIL;
+	}
+
+	int *arrayData = array->data;
+	simdKernels.reverse(arrayData, size);
+	simdKernels.reverse(arrayData, shift);
+	simdKernels.reverse(arrayData + shift, size - shift);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayFill(dynamicIntArray_t *array, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열을 특정 값으로 채우는 함수
+ * CPU 에 맞게 선택된 SIMD 채우기 커널을 사용하고, 큰 배열은 캐시를 거치지 않는 streaming store 로 채운다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param datum 채울 값(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayFill(dynamicIntArray_t *array, int datum)
+{
+	int *arrayData = dynamicIntArrayGetArrayPtr(array);
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayFill)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayFill") == FAIL)
+	{
+		return FAIL;
+	}
+
+	simdFill(array->data, array->size, datum);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayFillRange(dynamicIntArray_t *array, int from, int n, int datum)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 지정한 인덱스부터 n 개의 값을 특정 값으로 채우는 함수
+ * dynamicIntArrayFill 과 같은 SIMD 채우기 커널을 사용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param from 채우기를 시작할 인덱스(입력)
+ * @param n 채울 값의 개수(입력)
+ * @param datum 채울 값(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayFillRange(dynamicIntArray_t *array, int from, int n, int datum)
+{
+	if(dynamicIntArrayCheckBoundary(array, from) == FAIL)
+	{
+		PRINT_MSG("Fill range 실패. 인덱스 오류. (dynamicIntArrayFillRange)", ERROR, 0);
+		return FAIL;
+	}
+
+	size_t size = array->size;
+	if((n <= 0) || ((size_t)n > (size - (size_t)from)))
+	{
+		PRINT_MSG("Fill range 실패. 채울 개수 오류. (dynamicIntArrayFillRange, from:%d, n:%d, size:%zu)", ERROR, 3, from, n, size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayFillRange") == FAIL)
+	{
+		return FAIL;
+	}
+
+	simdFill(array->data + from, (size_t)n, datum);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int *dynamicIntArrayGetArrayPtr(const dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 주소를 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 구조체 포인터가 가지고 있는 동적 배열의 주소, 실패 시 NULL 반환
+ */
+int *dynamicIntArrayGetArrayPtr(const dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetArrayPtr)") == YES)
+	{
+		return NULL;
+	}
+
+	return array->data;
+}
+
+/**
+ * @fn int dynamicIntArrayGetSize(const dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 전체 크기를 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 동적 배열의 전체 크기, 실패 또는 크기가 int 범위를 넘으면 UNKNOWN 반환
+ */
+int dynamicIntArrayGetSize(const dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetSize)") == YES)
+	{
+		return UNKNOWN;
+	}
+
+	if(array->size > (size_t)INT_MAX)
+	{
+		PRINT_MSG("int 로 표현할 수 없는 크기. dynamicIntArrayGetSize64 를 사용해야 함. (dynamicIntArrayGetSize, size:%zu)", ERROR, 1, array->size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return UNKNOWN;
+	}
+
+	return (int)array->size;
+}
+
+/**
+ * @fn size_t dynamicIntArrayGetSize64(const dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 전체 크기를 반환하는 함수 (size_t 크기)
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 동적 배열의 전체 크기, 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayGetSize64(const dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetSize64)") == YES)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return array->size;
+}
+
+/**
+ * @fn int dynamicIntArrayGetCapacity(const dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에 할당된 용량을 반환하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 동적 배열의 용량, 실패 또는 용량이 int 범위를 넘으면 UNKNOWN 반환
+ */
+int dynamicIntArrayGetCapacity(const dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetCapacity)") == YES)
+	{
+		return UNKNOWN;
+	}
+
+	if(array->capacity > (size_t)INT_MAX)
+	{
+		PRINT_MSG("int 로 표현할 수 없는 용량. dynamicIntArrayGetCapacity64 를 사용해야 함. (dynamicIntArrayGetCapacity, capacity:%zu)", ERROR, 1, array->capacity);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return UNKNOWN;
+	}
+
+	return (int)array->capacity;
+}
+
+/**
+ * @fn size_t dynamicIntArrayGetCapacity64(const dynamicIntArray_t *array)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에 할당된 용량을 반환하는 함수 (size_t 용량)
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 동적 배열의 용량, 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayGetCapacity64(const dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetCapacity64)") == YES)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return array->capacity;
+}
+
+/**
+ * @fn int dynamicIntArrayCopy(dynamicIntArray_t *dst, int dstIndex, const dynamicIntArray_t *src, int srcIndex, int size)
+ * @brief 하나의 동적 배열 관리 구조체의 동적 배열을 다른 동적 배열 관리 구조체의 동적 배열로 복사하는 함수
+ * @param dst 복사될 동적 배열 관리 구조체 포인터(출력)
+ * @param dstIndex 복사될 배열의 시작 인덱스(입력)
+ * @param src 복사할 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param srcIndex 복사할 배열의 시작 인덱스(입력)
+ * @param size 복사할 크기(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayCopy(dynamicIntArray_t *dst, int dstIndex, const dynamicIntArray_t *src, int srcIndex, int size)
+{
+	if(size <= 0)
+	{
+		PRINT_MSG("복사 실패. 복사할 크기가 0. (dynamicIntArrayCopy, size:%d)", DEBUG, 1, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	if(dynamicIntArrayCheckBoundary(dst, dstIndex) == FAIL)
+	{
+		PRINT_MSG("복사 실패. destination 인덱스 오류. (dynamicIntArrayCopy)", ERROR, 0);
+		return FAIL;
+	}
+
+	if(dynamicIntArrayCheckBoundary(src, srcIndex) == FAIL)
+	{
+		PRINT_MSG("복사 실패. source 인덱스 오류. (dynamicIntArrayCopy)", ERROR, 0);
+		return FAIL;
+	}
+
+	return dynamicIntArrayCopy64(dst, (size_t)dstIndex, src, (size_t)srcIndex, (size_t)size);
+}
+
+/**
+ * @fn int dynamicIntArrayCopy64(dynamicIntArray_t *dst, size_t dstIndex, const dynamicIntArray_t *src, size_t srcIndex, size_t size)
+ * @brief 하나의 동적 배열 관리 구조체의 동적 배열을 다른 동적 배열 관리 구조체의 동적 배열로 복사하는 함수 (size_t 인덱스와 크기)
+ * @param dst 복사될 동적 배열 관리 구조체 포인터(출력)
+ * @param dstIndex 복사될 배열의 시작 인덱스(입력)
+ * @param src 복사할 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param srcIndex 복사할 배열의 시작 인덱스(입력)
+ * @param size 복사할 크기(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayCopy64(dynamicIntArray_t *dst, size_t dstIndex, const dynamicIntArray_t *src, size_t srcIndex, size_t size)
+{
+	if(size == 0)
+	{
+		PRINT_MSG("복사 실패. 복사할 크기가 0. (dynamicIntArrayCopy64, size:%zu)", DEBUG, 1, size);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	if(dynamicIntArrayCheckBoundary64(dst, dstIndex) == FAIL)
+	{
+		PRINT_MSG("복사 실패. destination 인덱스 오류. (dynamicIntArrayCopy64)", ERROR, 0);
+		return FAIL;
+	}
+
+	if(dynamicIntArrayCheckBoundary64(src, srcIndex) == FAIL)
+	{
+		PRINT_MSG("복사 실패. source 인덱스 오류. (dynamicIntArrayCopy64)", ERROR, 0);
+		return FAIL;
+	}
+
+	size_t srcSize = src->size;
+	if(size > (srcSize - srcIndex))
+	{
+		PRINT_MSG("복사하려는 크기가 지정한 인덱스부터 배열의 마지막까지의 크기보다 큼. (dynamicIntArrayCopy64, size:%zu, srcSize:%zu, srcIndex:%zu)", DEBUG, 3, size, srcSize, srcIndex);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	size_t dstSize = dst->size;
+	if(size > (dstSize - dstIndex))
+	{
+		PRINT_MSG("복사하려는 크기가 지정한 인덱스부터 배열의 마지막까지의 크기보다 큼. (dynamicIntArrayCopy64, size:%zu, dstSize:%zu, dstIndex:%zu)", DEBUG, 3, size, dstSize, dstIndex);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	if(prepareWrite(dst, "dynamicIntArrayCopy64") == FAIL)
+	{
+		return FAIL;
+	}
+
+	// 같은 동적 배열 안에서 겹치는 범위를 복사할 수도 있으므로 memmove 를 사용한다.
+	memmove(dst->data + dstIndex, src->data + srcIndex, size * sizeof(int));
+
+	return SUCCESS;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayClone(const dynamicIntArray_t *original)
+ * @brief 하나의 동적 배열 관리 구조체를 새로운 동적 배열 관리 구조체에 복제하는 함수
+ * @param original 복제할 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 새로 복제된 동적 배열 관리 구조체, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayClone(const dynamicIntArray_t *original)
+{
+	size_t size = dynamicIntArrayGetSize64(original);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayClone, array:%p)", DEBUG, 1, original);
+		return NULL;
+	}
+
+	// 복제본은 원본과 같은 할당자로 할당하고, 빈 동적 배열도 복제할 수 있도록 최소 용량 이상으로 할당한다.
+	size_t capacity = (size > DYNAMIC_INT_ARRAY_MIN_CAPACITY) ? size : DYNAMIC_INT_ARRAY_MIN_CAPACITY;
+	dynamicIntArray_t *new = newWithCapacity(size, capacity, original->allocator, "dynamicIntArrayClone");
+	if(checkObjectNull(new, "메모리 생성 실패, 새 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayClone)") == YES)
+	{
+		return NULL;
+	}
+
+	if ((size > 0) && (dynamicIntArrayCopy64(new, 0, original, 0, size) == FAIL))
+	{
+		PRINT_MSG("동적 배열 관리 구조체 복사 실패. (dynamicIntArrayClone, new:%p, original:%p, size:%zu)", DEBUG, 3, new, original, size);
+		dynamicIntArrayDelete(&new);
+		return NULL;
+	}
+
+	new->growthFactor = original->growthFactor;
+	new->growthMinIncrement = original->growthMinIncrement;
+	new->growthMaxSlack = original->growthMaxSlack;
+
+	if(checkObjectNull(original->stringOfArray, NULL) == NO)
+	{
+		size_t arrayLength = strlen(original->stringOfArray);
+		new->stringOfArray = (char*)new->allocator->allocate(new->allocator->context, arrayLength + 1);
+		if(checkObjectNull(new->stringOfArray, "메모리 생성 실패, 새로 생성한 문자열이 NULL. (dynamicIntArrayClone)") == YES)
+		{
+			dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+			dynamicIntArrayDelete(&new);
+			return NULL;
+		}
+		new->stringCapacity = arrayLength + 1;
+		memcpy(new->stringOfArray, original->stringOfArray, arrayLength + 1);
+	}
+
+	return new;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayCloneCow(dynamicIntArray_t *original)
+ * @brief 원소를 복사하지 않고 원본과 원소 저장소를 함께 사용하는 copy-on-write 복제본을 생성하는 함수
+ * 원본과 복제본은 참조 횟수(원자적 연산)로 원소 저장소를 함께 사용하고,
+ * 어느 쪽이든 원소나 크기를 처음 변경할 때(SetElement, Fill, Reverse, Append, InsertAt, RemoveAt 등) 그 쪽만 원소를 복사해서 분리한다.
+ * 함께 사용 중인 원소는 변경되지 않으므로 복제본을 다른 쓰레드에 넘겨서 읽기 전용 스냅샷으로 사용할 수 있다.
+ * 힙(인라인 저장소 제외), 큰 배열 모드, 넘겨받은 메모리 저장소만 함께 사용할 수 있고, 그 밖의 저장소는 dynamicIntArrayClone 으로 복제한다.
+ * 문자열 버퍼는 복사하지 않는다.
+ * @param original 복제할 동적 배열 관리 구조체 포인터(입력, 참조 횟수 블록이 연결됨)
+ * @return 성공 시 새로 복제된 동적 배열 관리 구조체, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayCloneCow(dynamicIntArray_t *original)
+{
+	if(checkObjectNull(original, "메모리 참조 실패, 복제할 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayCloneCow)") == YES)
+	{
+		return NULL;
+	}
+
+	if(((original->storageKind != STORAGE_HEAP) && (original->storageKind != STORAGE_HUGE) && (original->storageKind != STORAGE_ADOPTED))
+		|| (original->data == NULL) || (isInlineStorage(original) == YES))
+	{
+		return dynamicIntArrayClone(original);
+	}
+
+	const dynamicIntArrayAllocator_t *allocator = original->allocator;
+	if(original->cowBlock == NULL)
+	{
+		dynamicIntArrayCowBlock_t *block = (dynamicIntArrayCowBlock_t*)allocator->allocate(allocator->context, sizeof(dynamicIntArrayCowBlock_t));
+		if(checkObjectNull(block, "메모리 생성 실패, 참조 횟수 블록이 NULL. (dynamicIntArrayCloneCow)") == YES)
+		{
+			dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+			return NULL;
+		}
+		atomic_init(&block->refCount, 1);
+		original->cowBlock = block;
+	}
+
+	dynamicIntArray_t *new = (dynamicIntArray_t*)allocator->allocate(allocator->context, sizeof(dynamicIntArray_t));
+	if(checkObjectNull(new, "메모리 생성 실패, 새 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayCloneCow)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+		return NULL;
+	}
+
+	// 원소가 인라인 저장소에 있지 않으므로 구조체를 그대로 복사해도 data 는 함께 사용하는 저장소를 가리킨다.
+	*new = *original;
+	new->stringOfArray = NULL;
+	new->stringCapacity = 0;
+	atomic_fetch_add_explicit(&original->cowBlock->refCount, 1, memory_order_relaxed);
+
+	return new;
+}
+
+/**
+ * @fn int dynamicIntArrayDetach(dynamicIntArray_t *array)
+ * @brief copy-on-write 복제본과 함께 사용 중인 원소 저장소를 복사해서 분리하는 함수
+ * 변경 함수들은 자동으로 분리하므로, dynamicIntArrayGetArrayPtr 로 얻은 포인터로 직접 변경하기 전에만 호출하면 된다.
+ * 함께 사용하는 복제본이 없으면 복사하지 않는다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayDetach(dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayDetach)") == YES)
+	{
+		return FAIL;
+	}
+
+	return prepareWrite(array, "dynamicIntArrayDetach");
+}
+
+/**
+ * @fn size_t dynamicIntArrayGetShareCount(const dynamicIntArray_t *array)
+ * @brief 동적 배열의 원소 저장소를 함께 사용하는 동적 배열 개수를 반환하는 함수
+ * 다른 쓰레드의 복제본이 동시에 분리되거나 해제될 수 있으므로 반환값은 호출한 시점의 값이다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 자신을 포함한 개수(혼자 사용하면 1), 실패 시 0 반환
+ */
+size_t dynamicIntArrayGetShareCount(const dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetShareCount)") == YES)
+	{
+		return 0;
+	}
+
+	if(array->cowBlock == NULL)
+	{
+		return 1;
+	}
+
+	return atomic_load_explicit(&array->cowBlock->refCount, memory_order_relaxed);
+}
+
+/**
+ * @fn int dynamicIntArraySwap(dynamicIntArray_t *a, dynamicIntArray_t *b)
+ * @brief 두 동적 배열 관리 구조체의 원소 저장소(원소, 크기, 용량, 저장소 종류)를 복사 없이 맞바꾸는 함수
+ * 용량 증가 정책과 할당자, 문자열 버퍼는 각 구조체에 그대로 남는다.
+ * 인라인 저장소의 원소는 구조체를 따라 옮길 수 없으므로 복사한다. (DYNAMIC_INT_ARRAY_INLINE_CAPACITY 개 이하)
+ * 할당자로 할당한 원소 메모리와 copy-on-write 참조 횟수 블록은 그 할당자로 해제해야 하므로, 할당자가 다르면 맞바꿀 수 없다.
+ * @param a 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param b 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArraySwap(dynamicIntArray_t *a, dynamicIntArray_t *b)
+{
+	if((checkObjectNull(a, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArraySwap, a)") == YES)
+		|| (checkObjectNull(b, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArraySwap, b)") == YES))
+	{
+		return FAIL;
+	}
+
+	if(a == b)
+	{
+		return SUCCESS;
+	}
+
+	if((a->allocator != b->allocator) && ((isAllocatorBound(a) == YES) || (isAllocatorBound(b) == YES)))
+	{
+		PRINT_MSG("할당자가 다른 동적 배열의 원소 메모리는 맞바꿀 수 없음. (dynamicIntArraySwap, a:%p, b:%p)", ERROR, 2, a, b);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	dynamicIntArray_t temp;
+	takeStorage(&temp, a);
+	takeStorage(a, b);
+	takeStorage(b, &temp);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayMove(dynamicIntArray_t *dst, dynamicIntArray_t *src)
+ * @brief 원본 동적 배열의 원소 저장소를 복사 없이 대상 동적 배열로 옮기는 함수
+ * 대상의 기존 원소 저장소는 해제하고, 원본은 원소가 없는 빈 동적 배열이 된다. (원본 구조체는 계속 사용할 수 있음)
+ * 할당자로 할당한 원소 메모리와 copy-on-write 참조 횟수 블록은 그 할당자로 해제해야 하므로, 할당자가 다르면 옮길 수 없다.
+ * @param dst 원소 저장소를 넘겨받을 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param src 원소 저장소를 넘겨줄 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayMove(dynamicIntArray_t *dst, dynamicIntArray_t *src)
+{
+	if((checkObjectNull(dst, "메모리 참조 실패, 대상 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayMove)") == YES)
+		|| (checkObjectNull(src, "메모리 참조 실패, 원본 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayMove)") == YES))
+	{
+		return FAIL;
+	}
+
+	if(dst == src)
+	{
+		return SUCCESS;
+	}
+
+	if((dst->allocator != src->allocator) && (isAllocatorBound(src) == YES))
+	{
+		PRINT_MSG("할당자가 다른 동적 배열로 원소 메모리를 옮길 수 없음. (dynamicIntArrayMove, dst:%p, src:%p)", ERROR, 2, dst, src);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	releaseStorage(dst);
+	takeStorage(dst, src);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayAdopt(dynamicIntArray_t *array, int *buffer, int size, int capacity, dynamicIntArrayFree_f freeFunc)
+ * @brief 외부에서 할당한 메모리를 복사 없이 동적 배열의 원소 저장소로 넘겨받는 함수
+ * 자세한 내용은 dynamicIntArrayAdopt64 참고
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param buffer 넘겨받을 메모리(입력, capacity 개 이상의 원소를 담을 수 있어야 함)
+ * @param size 메모리에 저장된 원소 개수(입력)
+ * @param capacity 메모리에 저장할 수 있는 원소 개수(입력, size 이상, 0 보다 커야 함)
+ * @param freeFunc 메모리를 해제할 함수(입력, NULL 이면 해제하지 않음)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayAdopt(dynamicIntArray_t *array, int *buffer, int size, int capacity, dynamicIntArrayFree_f freeFunc)
+{
+	if((size < 0) || (capacity <= 0))
+	{
+		PRINT_MSG("크기 또는 용량 오류. (dynamicIntArrayAdopt, size:%d, capacity:%d)", ERROR, 2, size, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	return dynamicIntArrayAdopt64(array, buffer, (size_t)size, (size_t)capacity, freeFunc);
+}
+
+/**
+ * @fn int dynamicIntArrayAdopt64(dynamicIntArray_t *array, int *buffer, size_t size, size_t capacity, dynamicIntArrayFree_f freeFunc)
+ * @brief 외부에서 할당한 메모리를 복사 없이 동적 배열의 원소 저장소로 넘겨받는 함수
+ * 동적 배열의 기존 원소 저장소는 해제한다.
+ * 넘겨받은 메모리는 용량을 바꿔야 할 때까지 그대로 사용하고, 용량을 바꾸면 할당자로 새로 할당해서 옮긴 뒤 freeFunc 로 해제한다.
+ * freeFunc 가 NULL 이면 메모리를 해제하지 않으므로, 호출한 쪽이 동적 배열을 해제하거나 옮긴 뒤에 직접 해제해야 한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param buffer 넘겨받을 메모리(입력, capacity 개 이상의 원소를 담을 수 있어야 함)
+ * @param size 메모리에 저장된 원소 개수(입력)
+ * @param capacity 메모리에 저장할 수 있는 원소 개수(입력, size 이상, 0 보다 커야 함)
+ * @param freeFunc 메모리를 해제할 함수(입력, NULL 이면 해제하지 않음)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayAdopt64(dynamicIntArray_t *array, int *buffer, size_t size, size_t capacity, dynamicIntArrayFree_f freeFunc)
+{
+	if((checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayAdopt64)") == YES)
+		|| (checkObjectNull(buffer, "메모리 참조 실패, 넘겨받을 메모리가 NULL. (dynamicIntArrayAdopt64)") == YES))
+	{
+		return FAIL;
+	}
+
+	if((capacity == 0) || (size > capacity) || (capacity > DYNAMIC_INT_ARRAY_MAX_SIZE))
+	{
+		PRINT_MSG("크기 또는 용량 오류. (dynamicIntArrayAdopt64, size:%zu, capacity:%zu)", ERROR, 2, size, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	if(buffer == array->data)
+	{
+		PRINT_MSG("동적 배열이 이미 사용 중인 메모리는 넘겨받을 수 없음. (dynamicIntArrayAdopt64, buffer:%p)", ERROR, 1, buffer);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	releaseStorage(array);
+	array->storageKind = STORAGE_ADOPTED;
+	array->adoptedFree = freeFunc;
+	array->data = buffer;
+	array->size = size;
+	array->capacity = capacity;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int *dynamicIntArrayRelease(dynamicIntArray_t *array, int *size)
+ * @brief 동적 배열의 원소 메모리를 호출한 쪽으로 넘겨주고 동적 배열을 비우는 함수
+ * 자세한 내용은 dynamicIntArrayRelease64 참고
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param size 넘겨준 메모리의 원소 개수를 저장할 변수의 주소(출력)
+ * @return 성공 시 free 로 해제해야 하는 원소 메모리, 실패 시 NULL 반환
+ */
+int *dynamicIntArrayRelease(dynamicIntArray_t *array, int *size)
+{
+	if((checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayRelease)") == YES)
+		|| (checkObjectNull(size, "메모리 참조 실패, 크기를 저장할 변수의 주소가 NULL. (dynamicIntArrayRelease)") == YES))
+	{
+		return NULL;
+	}
+
+	if(array->size > (size_t)INT_MAX)
+	{
+		PRINT_MSG("int 로 표현할 수 없는 크기. dynamicIntArrayRelease64 를 사용해야 함. (dynamicIntArrayRelease, size:%zu)", ERROR, 1, array->size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return NULL;
+	}
+
+	size_t releasedSize = 0;
+	int *buffer = dynamicIntArrayRelease64(array, &releasedSize);
+	if(buffer != NULL)
+	{
+		*size = (int)releasedSize;
+	}
+
+	return buffer;
+}
+
+/**
+ * @fn int *dynamicIntArrayRelease64(dynamicIntArray_t *array, size_t *size)
+ * @brief 동적 배열의 원소 메모리를 호출한 쪽으로 넘겨주고 동적 배열을 비우는 함수
+ * 넘겨준 메모리는 호출한 쪽이 free 로 해제해야 한다.
+ * 기본 할당자로 할당한 힙 메모리와 free 로 해제하도록 넘겨받은 메모리는 복사 없이 넘겨주고,
+ * 그 밖의 저장소(인라인, 다른 할당자, 매핑, 큰 배열 모드, copy-on-write 복제본과 함께 사용 중인 저장소)는 malloc 으로 할당한 메모리에 복사해서 넘겨준 뒤 해제한다.
+ * 동적 배열은 원소가 없는 빈 동적 배열이 되고 계속 사용할 수 있다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param size 넘겨준 메모리의 원소 개수를 저장할 변수의 주소(출력)
+ * @return 성공 시 free 로 해제해야 하는 원소 메모리, 실패 시 NULL 반환
+ */
+int *dynamicIntArrayRelease64(dynamicIntArray_t *array, size_t *size)
+{
+	if((checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayRelease64)") == YES)
+		|| (checkObjectNull(size, "메모리 참조 실패, 크기를 저장할 변수의 주소가 NULL. (dynamicIntArrayRelease64)") == YES))
+	{
+		return NULL;
+	}
+
+	size_t releasedSize = array->size;
+	int *buffer = NULL;
+	if((array->cowBlock == NULL)
+		&& (((isAllocatorOwned(array) == YES) && (array->allocator == &libcAllocator))
+			|| ((array->storageKind == STORAGE_ADOPTED) && (array->adoptedFree == free))))
+	{
+		buffer = array->data;
+		setEmptyStorage(array);
+	}
+	else
+	{
+		buffer = (int*)malloc(((releasedSize > 0) ? releasedSize : 1) * sizeof(int));
+		if(checkObjectNull(buffer, "메모리 생성 실패, 넘겨줄 메모리가 NULL. (dynamicIntArrayRelease64)") == YES)
+		{
+			dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+			return NULL;
+		}
+		if(releasedSize > 0)
+		{
+			memcpy(buffer, array->data, releasedSize * sizeof(int));
+		}
+		releaseStorage(array);
+		setEmptyStorage(array);
+	}
+
+	*size = releasedSize;
+	return buffer;
+}
+
+/**
+ * @fn int dynamicIntArrayCheckBoundary(const dynamicIntArray_t *array, int index)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 바운더리에 지정한 인덱스가 허용되는지 검사하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param index 검사할 인덱스(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayCheckBoundary(const dynamicIntArray_t *array, int index)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayCheckBoundary, array:%p)", DEBUG, 1, array);
+		return FAIL;
+	}
+
+	if ((index < 0) || ((size_t)index >= size))
+	{
+		PRINT_MSG("동적 배열의 인덱스 바운더리 오류. (dynamicIntArrayCheckBoundary, index:%d, range:0~%zu)", DEBUG, 2, index, size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayCheckBoundary64(const dynamicIntArray_t *array, size_t index)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 바운더리에 지정한 인덱스가 허용되는지 검사하는 함수 (size_t 인덱스)
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param index 검사할 인덱스(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayCheckBoundary64(const dynamicIntArray_t *array, size_t index)
+{
+	size_t size = dynamicIntArrayGetSize64(array);
+	if(size == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		PRINT_MSG("dynamicIntArrayGetSize64 실패. (dynamicIntArrayCheckBoundary64, array:%p)", DEBUG, 1, array);
+		return FAIL;
+	}
+
+	if (index >= size)
+	{
+		PRINT_MSG("동적 배열의 인덱스 바운더리 오류. (dynamicIntArrayCheckBoundary64, index:%zu, range:0~%zu)", DEBUG, 2, index, size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn char *dynamicIntArrayToString(dynamicIntArray_t *array)
+ * @brief 동적 배열의 모든 원소를 담고 있는 문자열을 반환하는 함수
+ * 문자열의 길이를 먼저 계산해서 한 번만 할당하고, 원소들을 한 번에 이어서 형식화한다.
+ * 반환된 문자열은 동적 배열 관리 구조체가 관리하며 다음 호출 시 갱신된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @return 성공 시 생성한 문자열, 실패 시 NULL 반환
+ */
+char *dynamicIntArrayToString(dynamicIntArray_t *array)
+{
+	int *arrayData = dynamicIntArrayGetArrayPtr(array);
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayToString)") == YES)
+	{
+		return NULL;
+	}
+
+	// 1. 형식화된 문자열의 길이를 계산해서 널 문자를 포함한 크기로 (재)생성한다.
+	size_t stringLength = getFormattedLength(arrayData, array->size) + 1;
+	char *string = (char*)array->allocator->reallocate(array->allocator->context, array->stringOfArray, array->stringCapacity, stringLength);
+	if(checkObjectNull(string, "메모리 참조 실패, 재생성한 문자열이 NULL. (dynamicIntArrayToString)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+		return NULL;
+	}
+	array->stringOfArray = string;
+	array->stringCapacity = stringLength;
+
+	// 2. 생성한 문자열에 동적 배열에 저장된 값들을 형식화한다.
+	if(dynamicIntArrayFormatTo(array, string, stringLength) == FAIL)
+	{
+		PRINT_MSG("dynamicIntArrayFormatTo 실패. (dynamicIntArrayToString)", DEBUG, 0);
+		return NULL;
+	}
+
+	return string;
+}
+
+/**
+ * @fn ssize_t dynamicIntArrayFormatTo(const dynamicIntArray_t *array, char *buf, size_t cap)
+ * @brief 동적 배열의 모든 원소를 호출자가 제공한 버퍼에 문자열로 형식화하는 함수
+ * snprintf 처럼 버퍼가 작으면 들어가는 만큼만 저장하고, 항상 널 문자로 끝맺는다.
+ * buf 가 NULL 이거나 cap 이 0 이면 아무것도 저장하지 않고 필요한 길이만 계산한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param buf 문자열을 저장할 버퍼(출력)
+ * @param cap 버퍼 크기(입력, 널 문자 포함)
+ * @return 성공 시 전체 문자열 길이 (널 문자 제외, cap 이상이면 잘렸음을 의미), 실패 시 FAIL 반환
+ */
+ssize_t dynamicIntArrayFormatTo(const dynamicIntArray_t *array, char *buf, size_t cap)
+{
+	int *arrayData = dynamicIntArrayGetArrayPtr(array);
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayFormatTo)") == YES)
+	{
+		return FAIL;
+	}
+
+	if((buf == NULL) || (cap == 0))
+	{
+		return (ssize_t)getFormattedLength(arrayData, array->size);
+	}
+
+	formatBuffer_t context = { buf, cap, 0 };
+	ssize_t length = formatArray(arrayData, array->size, formatBufferSink, &context);
+	buf[context.length] = '\0';
+
+	return length;
+}
+
+/**
+ * @fn ssize_t dynamicIntArrayWriteTo(const dynamicIntArray_t *array, int fd)
+ * @brief 동적 배열의 모든 원소를 문자열로 형식화해서 파일 디스크립터에 쓰는 함수
+ * 전체 문자열을 만들지 않고 DYNAMIC_INT_ARRAY_FORMAT_CHUNK_SIZE 크기 단위로 나누어 쓴다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param fd 쓸 파일 디스크립터(입력)
+ * @return 성공 시 쓴 바이트 수, 실패 시 FAIL 반환
+ */
+ssize_t dynamicIntArrayWriteTo(const dynamicIntArray_t *array, int fd)
+{
+	int *arrayData = dynamicIntArrayGetArrayPtr(array);
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayWriteTo)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(fd < 0)
+	{
+		PRINT_MSG("잘못된 파일 디스크립터. (dynamicIntArrayWriteTo, fd:%d)", ERROR, 1, fd);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	ssize_t length = formatArray(arrayData, array->size, formatFdSink, &fd);
+	if(length == FAIL)
+	{
+		PRINT_MSG("파일 디스크립터 쓰기 실패. (dynamicIntArrayWriteTo, fd:%d, errno:%d)", ERROR, 2, fd, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return FAIL;
+	}
+
+	return length;
+}
+
+/**
+ * @fn ssize_t dynamicIntArrayWriteToFile(const dynamicIntArray_t *array, FILE *stream)
+ * @brief 동적 배열의 모든 원소를 문자열로 형식화해서 파일 스트림에 쓰는 함수
+ * 전체 문자열을 만들지 않고 DYNAMIC_INT_ARRAY_FORMAT_CHUNK_SIZE 크기 단위로 나누어 쓴다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param stream 쓸 파일 스트림(입력)
+ * @return 성공 시 쓴 바이트 수, 실패 시 FAIL 반환
+ */
+ssize_t dynamicIntArrayWriteToFile(const dynamicIntArray_t *array, FILE *stream)
+{
+	int *arrayData = dynamicIntArrayGetArrayPtr(array);
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayWriteToFile)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(checkObjectNull(stream, "메모리 참조 실패, 파일 스트림이 NULL. (dynamicIntArrayWriteToFile)") == YES)
+	{
+		return FAIL;
+	}
+
+	ssize_t length = formatArray(arrayData, array->size, formatFileSink, stream);
+	if(length == FAIL)
+	{
+		PRINT_MSG("파일 스트림 쓰기 실패. (dynamicIntArrayWriteToFile, errno:%d)", ERROR, 1, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return FAIL;
+	}
+
+	return length;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayFromString(const char *string)
+ * @brief dynamicIntArrayToString 이 만드는 "{ 1, 2, 3 }" 형식의 문자열로부터 동적 배열을 생성하는 함수
+ * @param string 변환할 문자열(입력, 읽기 전용, 널 문자로 끝나야 함)
+ * @return 성공 시 새로 생성된 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayFromString(const char *string)
+{
+	if(checkObjectNull(string, "메모리 참조 실패, 변환할 문자열이 NULL. (dynamicIntArrayFromString)") == YES)
+	{
+		return NULL;
+	}
+
+	return dynamicIntArrayParseBuffer(string, strlen(string));
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayParseBuffer(const char *buffer, size_t length)
+ * @brief "{ 1, 2, 3 }" 형식의 문자열 버퍼로부터 동적 배열을 생성하는 함수
+ * 쉼표 개수로 원소 개수를 미리 계산해서 동적 배열을 한 번만 할당한다.
+ * @param buffer 변환할 문자열 버퍼(입력, 읽기 전용, 널 문자로 끝나지 않아도 됨)
+ * @param length 문자열 버퍼 길이(입력)
+ * @return 성공 시 새로 생성된 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayParseBuffer(const char *buffer, size_t length)
+{
+	if(checkObjectNull(buffer, "메모리 참조 실패, 변환할 문자열 버퍼가 NULL. (dynamicIntArrayParseBuffer)") == YES)
+	{
+		return NULL;
+	}
+
+	dynamicIntArrayParser_t parser;
+	dynamicIntArrayParserInitialize(&parser);
+
+	if(dynamicIntArrayParserFeed(&parser, buffer, length) == FAIL)
+	{
+		PRINT_MSG("dynamicIntArrayParserFeed 실패. (dynamicIntArrayParseBuffer)", DEBUG, 0);
+		dynamicIntArrayParserFinal(&parser);
+		return NULL;
+	}
+
+	return dynamicIntArrayParserFinish(&parser);
+}
+
+/**
+ * @fn int dynamicIntArraySave(const dynamicIntArray_t *array, int fd, int isBlockChecksum)
+ * @brief 동적 배열을 이진 형식(dynamicIntArrayFileHeader_t 참고)으로 파일 디스크립터에 쓰는 함수
+ * 헤더를 쓴 뒤 원소들을 DYNAMIC_INT_ARRAY_FILE_BLOCK_SIZE 개씩 복사 없이 바로 쓰므로 파이프나 소켓에도 쓸 수 있다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param fd 쓸 파일 디스크립터(입력)
+ * @param isBlockChecksum 블록마다 체크섬을 붙일지 여부(입력, YES 또는 NO)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArraySave(const dynamicIntArray_t *array, int fd, int isBlockChecksum)
+{
+	int *arrayData = dynamicIntArrayGetArrayPtr(array);
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArraySave)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(fd < 0)
+	{
+		PRINT_MSG("잘못된 파일 디스크립터. (dynamicIntArraySave, fd:%d)", ERROR, 1, fd);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	size_t count = (size_t)array->size;
+
+	// 1. 헤더에 전체 체크섬이 들어가므로 원소들의 체크섬을 먼저 계산한다.
+	dynamicIntArrayFileHeader_t header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, DYNAMIC_INT_ARRAY_FILE_MAGIC, sizeof(header.magic));
+	header.version = DYNAMIC_INT_ARRAY_FILE_VERSION;
+	header.elementWidth = (uint8_t)sizeof(int);
+	header.flags = (uint8_t)(((HOST_IS_BIG_ENDIAN == 1) ? FILE_FLAG_BIG_ENDIAN : 0) | ((isBlockChecksum == YES) ? FILE_FLAG_BLOCK_CHECKSUM : 0));
+	header.blockSize = DYNAMIC_INT_ARRAY_FILE_BLOCK_SIZE;
+	header.count = count;
+	header.checksum = updateChecksum(1, arrayData, count * sizeof(int));
+	header.headerChecksum = updateChecksum(1, &header, offsetof(dynamicIntArrayFileHeader_t, headerChecksum));
+
+	if(writeAll(fd, &header, sizeof(header)) == FAIL)
+	{
+		PRINT_MSG("헤더 쓰기 실패. (dynamicIntArraySave, fd:%d, errno:%d)", ERROR, 2, fd, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return FAIL;
+	}
+
+	// 2. 원소들을 블록 단위로 쓰고, 필요하면 블록마다 체크섬을 붙인다.
+	size_t offset = 0;
+	while(offset < count)
+	{
+		size_t blockCount = ((count - offset) < DYNAMIC_INT_ARRAY_FILE_BLOCK_SIZE) ? (count - offset) : DYNAMIC_INT_ARRAY_FILE_BLOCK_SIZE;
+		size_t blockLength = blockCount * sizeof(int);
+
+		if(writeAll(fd, arrayData + offset, blockLength) == FAIL)
+		{
+			PRINT_MSG("원소 쓰기 실패. (dynamicIntArraySave, fd:%d, offset:%zu, errno:%d)", ERROR, 3, fd, offset, errno);
+			dynamicIntArraySetLastError(ERROR_IO);
+			return FAIL;
+		}
+
+		if(isBlockChecksum == YES)
+		{
+			uint32_t blockChecksum = updateChecksum(1, arrayData + offset, blockLength);
+			if(writeAll(fd, &blockChecksum, sizeof(blockChecksum)) == FAIL)
+			{
+				PRINT_MSG("블록 체크섬 쓰기 실패. (dynamicIntArraySave, fd:%d, offset:%zu, errno:%d)", ERROR, 3, fd, offset, errno);
+				dynamicIntArraySetLastError(ERROR_IO);
+				return FAIL;
+			}
+		}
+
+		offset += blockCount;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayLoad(int fd)
+ * @brief 이진 형식(dynamicIntArrayFileHeader_t 참고)으로 저장된 동적 배열을 파일 디스크립터에서 읽는 함수
+ * 헤더의 원소 개수로 동적 배열을 한 번만 할당하고, 원소들을 블록 단위로 동적 배열에 바로 읽는다.
+ * 바이트 순서가 다른 플랫폼에서 저장한 파일도 읽을 수 있다.
+ * @param fd 읽을 파일 디스크립터(입력)
+ * @return 성공 시 새로 생성된 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayLoad(int fd)
+{
+	if(fd < 0)
+	{
+		PRINT_MSG("잘못된 파일 디스크립터. (dynamicIntArrayLoad, fd:%d)", ERROR, 1, fd);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	// 1. 헤더를 읽고 검사한다.
+	dynamicIntArrayFileHeader_t header;
+	if(readAll(fd, &header, sizeof(header)) != sizeof(header))
+	{
+		PRINT_MSG("헤더 읽기 실패. (dynamicIntArrayLoad, fd:%d, errno:%d)", ERROR, 2, fd, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return NULL;
+	}
+
+	int isSwapped = NO;
+	if(checkFileHeader(&header, &isSwapped) == FAIL)
+	{
+		PRINT_MSG("checkFileHeader 실패. (dynamicIntArrayLoad)", DEBUG, 0);
+		return NULL;
+	}
+
+	if(header.count > (uint64_t)DYNAMIC_INT_ARRAY_MAX_SIZE)
+	{
+		PRINT_MSG("원소 개수 오류. 최대 원소 개수 초과. (dynamicIntArrayLoad, count:%llu)", ERROR, 1, (unsigned long long)header.count);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return NULL;
+	}
+
+	// 2. 헤더의 원소 개수만큼 한 번에 할당한다.
+	size_t count = (size_t)header.count;
+	dynamicIntArray_t *array = newWithCapacity(0, (count > 0) ? count : 1, defaultAllocator, "dynamicIntArrayLoad");
+	if(checkObjectNull(array, "메모리 생성 실패, 읽어들일 동적 배열이 NULL. (dynamicIntArrayLoad)") == YES)
+	{
+		return NULL;
+	}
+
+	// 3. 원소들을 블록 단위로 읽으면서 체크섬을 검사한다.
+	int *arrayData = array->data;
+	uint32_t checksum = 1;
+	size_t offset = 0;
+	while(offset < count)
+	{
+		size_t blockCount = ((count - offset) < header.blockSize) ? (count - offset) : header.blockSize;
+		size_t blockLength = blockCount * sizeof(int);
+
+		if(readAll(fd, arrayData + offset, blockLength) != blockLength)
+		{
+			PRINT_MSG("원소 읽기 실패. (dynamicIntArrayLoad, fd:%d, offset:%zu, errno:%d)", ERROR, 3, fd, offset, errno);
+			dynamicIntArraySetLastError(ERROR_IO);
+			dynamicIntArrayDelete(&array);
+			return NULL;
+		}
+
+		if((header.flags & FILE_FLAG_BLOCK_CHECKSUM) != 0)
+		{
+			uint32_t blockChecksum = 0;
+			if(readAll(fd, &blockChecksum, sizeof(blockChecksum)) != sizeof(blockChecksum))
+			{
+				PRINT_MSG("블록 체크섬 읽기 실패. (dynamicIntArrayLoad, fd:%d, offset:%zu, errno:%d)", ERROR, 3, fd, offset, errno);
+				dynamicIntArraySetLastError(ERROR_IO);
+				dynamicIntArrayDelete(&array);
+				return NULL;
+			}
+
+			if(isSwapped == YES) blockChecksum = __builtin_bswap32(blockChecksum);
+			if(blockChecksum != updateChecksum(1, arrayData + offset, blockLength))
+			{
+				PRINT_MSG("블록 체크섬 불일치. (dynamicIntArrayLoad, offset:%zu)", ERROR, 1, offset);
+				dynamicIntArraySetLastError(ERROR_CHECKSUM);
+				dynamicIntArrayDelete(&array);
+				return NULL;
+			}
+		}
+
+		checksum = updateChecksum(checksum, arrayData + offset, blockLength);
+		offset += blockCount;
+	}
+
+	if(((header.flags & FILE_FLAG_UNCHECKED) == 0) && (checksum != header.checksum))
+	{
+		PRINT_MSG("체크섬 불일치. (dynamicIntArrayLoad, checksum:%u, expected:%u)", ERROR, 2, checksum, header.checksum);
+		dynamicIntArraySetLastError(ERROR_CHECKSUM);
+		dynamicIntArrayDelete(&array);
+		return NULL;
+	}
+
+	// 4. 바이트 순서가 다른 플랫폼에서 저장한 파일이면 원소들의 바이트 순서를 바꾼다.
+	if(isSwapped == YES)
+	{
+		size_t loopIndex = 0;
+		for( ; loopIndex < count; loopIndex++)
+		{
+			arrayData[loopIndex] = (int)__builtin_bswap32((uint32_t)arrayData[loopIndex]);
+		}
+	}
+
+	array->size = count;
+
+	return array;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayOpenMapped(const char *path, int mode)
+ * @brief 이진 형식(dynamicIntArrayFileHeader_t 참고) 파일을 메모리에 매핑해서 동적 배열로 여는 함수
+ * 원소들을 복사하지 않고 파일을 그대로 사용하므로 큰 배열도 바로 열리고, 여러 프로세스가 같은 페이지를 공유한다.
+ * 읽기 전용으로 열면 원소를 변경하는 함수들은 ERROR_READ_ONLY 로 실패한다.
+ * 읽기/쓰기로 열면 변경 내용이 파일에 반영되고, 용량이 부족하면 파일 크기를 늘린 뒤 다시 매핑한다.
+ * 블록 체크섬이 있거나 바이트 순서가 다른 파일은 매핑할 수 없으므로 dynamicIntArrayLoad 를 사용해야 한다.
+ * @param path 파일 경로(입력, 읽기 전용)
+ * @param mode 매핑 모드(입력, MAP_MODE 열거형 참고, 읽기/쓰기는 파일이 없으면 생성)
+ * @return 성공 시 새로 생성된 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayOpenMapped(const char *path, int mode)
+{
+	if(checkObjectNull(path, "메모리 참조 실패, 파일 경로가 NULL. (dynamicIntArrayOpenMapped)") == YES)
+	{
+		return NULL;
+	}
+
+	if((mode != MAP_MODE_READ_ONLY) && (mode != MAP_MODE_READ_WRITE))
+	{
+		PRINT_MSG("알 수 없는 매핑 모드. (dynamicIntArrayOpenMapped, mode:%d)", ERROR, 1, mode);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	// 1. 파일을 열고 크기를 확인한다. 읽기/쓰기 모드에서 빈 파일이면 최소 용량으로 새로 만든다.
+	int isWritable = (mode == MAP_MODE_READ_WRITE) ? YES : NO;
+	int fd = open(path, (isWritable == YES) ? (O_RDWR | O_CREAT | O_CLOEXEC) : (O_RDONLY | O_CLOEXEC), 0644);
+	if(fd < 0)
+	{
+		PRINT_MSG("파일 열기 실패. (dynamicIntArrayOpenMapped, path:%s, errno:%d)", ERROR, 2, path, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return NULL;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) != 0)
+	{
+		PRINT_MSG("파일 정보 확인 실패. (dynamicIntArrayOpenMapped, path:%s, errno:%d)", ERROR, 2, path, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		close(fd);
+		return NULL;
+	}
+
+	int isNewFile = ((fileStat.st_size == 0) && (isWritable == YES)) ? YES : NO;
+	size_t mapLength = (size_t)fileStat.st_size;
+	if(isNewFile == YES)
+	{
+		mapLength = sizeof(dynamicIntArrayFileHeader_t) + (DYNAMIC_INT_ARRAY_MIN_CAPACITY * sizeof(int));
+		if(ftruncate(fd, (off_t)mapLength) != 0)
+		{
+			PRINT_MSG("파일 크기 변경 실패. (dynamicIntArrayOpenMapped, path:%s, errno:%d)", ERROR, 2, path, errno);
+			dynamicIntArraySetLastError(ERROR_IO);
+			close(fd);
+			return NULL;
+		}
+	}
+	else if(mapLength < sizeof(dynamicIntArrayFileHeader_t))
+	{
+		PRINT_MSG("파일 형식 오류. 파일이 헤더보다 작음. (dynamicIntArrayOpenMapped, path:%s, length:%zu)", ERROR, 2, path, mapLength);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		close(fd);
+		return NULL;
+	}
+
+	// 2. 파일 전체(헤더 포함)를 공유 매핑한다.
+	void *mapBase = mmap(NULL, mapLength, (isWritable == YES) ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+	if(mapBase == MAP_FAILED)
+	{
+		PRINT_MSG("파일 매핑 실패. (dynamicIntArrayOpenMapped, path:%s, errno:%d)", ERROR, 2, path, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		close(fd);
+		return NULL;
+	}
+
+	// 3. 헤더를 검사한다. 새 파일이면 원소 개수가 0 인 헤더를 쓴다.
+	dynamicIntArrayFileHeader_t *mappedHeader = (dynamicIntArrayFileHeader_t*)mapBase;
+	dynamicIntArrayFileHeader_t header;
+	if(isNewFile == YES)
+	{
+		memset(mappedHeader, 0, sizeof(dynamicIntArrayFileHeader_t));
+		memcpy(mappedHeader->magic, DYNAMIC_INT_ARRAY_FILE_MAGIC, sizeof(mappedHeader->magic));
+		mappedHeader->version = DYNAMIC_INT_ARRAY_FILE_VERSION;
+		mappedHeader->elementWidth = (uint8_t)sizeof(int);
+		mappedHeader->flags = (uint8_t)((HOST_IS_BIG_ENDIAN == 1) ? FILE_FLAG_BIG_ENDIAN : 0);
+		mappedHeader->blockSize = DYNAMIC_INT_ARRAY_FILE_BLOCK_SIZE;
+		mappedHeader->headerChecksum = updateChecksum(1, mappedHeader, offsetof(dynamicIntArrayFileHeader_t, headerChecksum));
+	}
+
+	memcpy(&header, mappedHeader, sizeof(header));
+	int isSwapped = NO;
+	if(checkFileHeader(&header, &isSwapped) == FAIL)
+	{
+		PRINT_MSG("checkFileHeader 실패. (dynamicIntArrayOpenMapped, path:%s)", DEBUG, 1, path);
+		munmap(mapBase, mapLength);
+		close(fd);
+		return NULL;
+	}
+
+	size_t capacity = (mapLength - sizeof(dynamicIntArrayFileHeader_t)) / sizeof(int);
+	if((isSwapped == YES) || ((header.flags & FILE_FLAG_BLOCK_CHECKSUM) != 0) || (header.count > (uint64_t)capacity))
+	{
+		PRINT_MSG("파일 형식 오류. 매핑할 수 없는 파일. (dynamicIntArrayOpenMapped, path:%s, flags:%d, count:%llu)", ERROR, 3, path, (int)header.flags, (unsigned long long)header.count);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		munmap(mapBase, mapLength);
+		close(fd);
+		return NULL;
+	}
+
+	const dynamicIntArrayAllocator_t *allocator = defaultAllocator;
+	dynamicIntArray_t *array = (dynamicIntArray_t*)allocator->allocate(allocator->context, sizeof(dynamicIntArray_t));
+	if(checkObjectNull(array, "메모리 생성 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayOpenMapped)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+		munmap(mapBase, mapLength);
+		close(fd);
+		return NULL;
+	}
+
+	array->size = (size_t)header.count;
+	array->capacity = capacity;
+	array->reservedCapacity = 0;
+	array->growthFactor = DYNAMIC_INT_ARRAY_GROWTH_FACTOR;
+	array->growthMinIncrement = DYNAMIC_INT_ARRAY_GROWTH_MIN_INCREMENT;
+	array->growthMaxSlack = DYNAMIC_INT_ARRAY_GROWTH_MAX_SLACK;
+	array->data = (int*)((char*)mapBase + sizeof(dynamicIntArrayFileHeader_t));
+	array->stringOfArray = NULL;
+	array->stringCapacity = 0;
+	array->storageKind = (isWritable == YES) ? STORAGE_MAPPED_READ_WRITE : STORAGE_MAPPED_READ_ONLY;
+	array->storageFd = fd;
+	array->storageBase = mapBase;
+	array->storageLength = mapLength;
+	array->storageGeneration = 0;
+	array->adoptedFree = NULL;
+	array->cowBlock = NULL;
+	array->allocator = allocator;
+
+	// 읽기/쓰기 매핑은 원소가 바뀔 때마다 전체 체크섬을 다시 계산할 수 없으므로 관리하지 않는다고 표시한다.
+	if(isWritable == YES)
+	{
+		updateMappedHeader(array);
+	}
+
+	return array;
+}
+
+/**
+ * @fn int dynamicIntArraySync(dynamicIntArray_t *array)
+ * @brief 읽기/쓰기로 매핑한 동적 배열의 헤더(원소 개수)를 갱신하고 변경 내용을 파일에 동기화(msync)하는 함수
+ * 읽기/쓰기 공유 메모리는 현재 크기를 헤더에 게시해서 다른 프로세스가 dynamicIntArrayRefresh 로 볼 수 있게 한다.
+ * 힙이나 읽기 전용 저장소는 동기화할 내용이 없으므로 바로 성공한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArraySync(dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArraySync)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(array->storageKind == STORAGE_SHARED_READ_WRITE)
+	{
+		publishSharedHeader(array);
+		return SUCCESS;
+	}
+
+	if(array->storageKind != STORAGE_MAPPED_READ_WRITE)
+	{
+		return SUCCESS;
+	}
+
+	updateMappedHeader(array);
+	if(msync(array->storageBase, array->storageLength, MS_SYNC) != 0)
+	{
+		PRINT_MSG("파일 동기화 실패. (dynamicIntArraySync, errno:%d)", ERROR, 1, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayCreateShared(const char *name, int capacity)
+ * @brief 여러 프로세스가 복사 없이 함께 사용할 수 있는 공유 메모리 동적 배열을 생성하는 함수
+ * 공유 메모리 앞에는 크기와 세대 번호를 담은 헤더(dynamicIntArraySharedHeader_t 참고)가 있고, 그 뒤에 원소들이 저장된다.
+ * 이름을 지정하면 shm_open 으로 새 공유 메모리 객체를 만들고(이미 있으면 실패), 다른 프로세스는 dynamicIntArrayAttachShared 로 연결한다.
+ * 이름이 NULL 이면 memfd 로 이름 없는 객체를 만들고, 다른 프로세스에는 dynamicIntArrayGetSharedFd 의 파일 디스크립터를 fork 나 SCM_RIGHTS 로 전달한다.
+ * 변경 내용은 dynamicIntArraySync 로 게시하며, 용량이 늘어날 때는 자동으로 게시된다.
+ * 쓰는 프로세스는 하나여야 하며, 여러 프로세스가 쓰려면 호출자가 직접 동기화해야 한다.
+ * @param name 공유 메모리 객체 이름(입력, 읽기 전용, "/" 로 시작, NULL 이면 이름 없는 memfd)
+ * @param capacity 처음 할당할 용량(입력)
+ * @return 성공 시 새로 생성된 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayCreateShared(const char *name, int capacity)
+{
+	if(capacity <= 0)
+	{
+		PRINT_MSG("용량이 0 보다 작거나 같음. (dynamicIntArrayCreateShared, capacity:%d)", ERROR, 1, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	// 1. 공유 메모리 객체를 만든다.
+	int fd = -1;
+	if(name != NULL)
+	{
+		fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	}
+	else
+	{
+#ifdef MFD_CLOEXEC
+		fd = memfd_create("dynamicIntArray", MFD_CLOEXEC);
+#else
+		errno = ENOSYS;
+#endif
+	}
+
+	if(fd < 0)
+	{
+		PRINT_MSG("공유 메모리 생성 실패. (dynamicIntArrayCreateShared, name:%s, errno:%d)", ERROR, 2, (name != NULL) ? name : "(memfd)", errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return NULL;
+	}
+
+	// 2. 헤더와 용량만큼 크기를 정하고 헤더를 쓴다. (원소 영역은 ftruncate 로 0 으로 채워짐)
+	dynamicIntArraySharedHeader_t header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, DYNAMIC_INT_ARRAY_SHARED_MAGIC, sizeof(header.magic));
+	header.version = DYNAMIC_INT_ARRAY_SHARED_VERSION;
+	header.elementWidth = (uint8_t)sizeof(int);
+	header.capacity = (uint64_t)capacity;
+
+	size_t mapLength = sizeof(dynamicIntArraySharedHeader_t) + ((size_t)capacity * sizeof(int));
+	if((ftruncate(fd, (off_t)mapLength) != 0) || (pwrite(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)))
+	{
+		PRINT_MSG("공유 메모리 초기화 실패. (dynamicIntArrayCreateShared, capacity:%d, errno:%d)", ERROR, 2, capacity, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		close(fd);
+		if(name != NULL) shm_unlink(name);
+		return NULL;
+	}
+
+	// 3. 만든 객체에 읽기/쓰기로 연결한다.
+	dynamicIntArray_t *array = dynamicIntArrayAttachSharedFd(fd, MAP_MODE_READ_WRITE);
+	if(array == NULL)
+	{
+		PRINT_MSG("dynamicIntArrayAttachSharedFd 실패. (dynamicIntArrayCreateShared)", DEBUG, 0);
+		close(fd);
+		if(name != NULL) shm_unlink(name);
+		return NULL;
+	}
+
+	return array;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayAttachShared(const char *name, int mode)
+ * @brief 다른 프로세스가 dynamicIntArrayCreateShared 로 생성한 공유 메모리 동적 배열에 이름으로 연결하는 함수
+ * @param name 공유 메모리 객체 이름(입력, 읽기 전용)
+ * @param mode 매핑 모드(입력, MAP_MODE 열거형 참고)
+ * @return 성공 시 새로 생성된 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayAttachShared(const char *name, int mode)
+{
+	if(checkObjectNull(name, "메모리 참조 실패, 공유 메모리 이름이 NULL. (dynamicIntArrayAttachShared)") == YES)
+	{
+		return NULL;
+	}
+
+	int fd = shm_open(name, ((mode == MAP_MODE_READ_WRITE) ? O_RDWR : O_RDONLY) | O_CLOEXEC, 0);
+	if(fd < 0)
+	{
+		PRINT_MSG("공유 메모리 열기 실패. (dynamicIntArrayAttachShared, name:%s, errno:%d)", ERROR, 2, name, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return NULL;
+	}
+
+	dynamicIntArray_t *array = dynamicIntArrayAttachSharedFd(fd, mode);
+	if(array == NULL)
+	{
+		PRINT_MSG("dynamicIntArrayAttachSharedFd 실패. (dynamicIntArrayAttachShared, name:%s)", DEBUG, 1, name);
+		close(fd);
+		return NULL;
+	}
+
+	return array;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayAttachSharedFd(int fd, int mode)
+ * @brief 공유 메모리 동적 배열의 파일 디스크립터로 연결하는 함수
+ * 성공하면 파일 디스크립터는 동적 배열이 소유하며 dynamicIntArrayDelete 에서 닫힌다. 실패하면 호출자가 닫아야 한다.
+ * 원소를 복사하지 않고 같은 페이지를 매핑하므로, 다른 프로세스의 변경 내용은 dynamicIntArrayRefresh 후 크기에 반영된다.
+ * @param fd 공유 메모리 객체의 파일 디스크립터(입력)
+ * @param mode 매핑 모드(입력, MAP_MODE 열거형 참고)
+ * @return 성공 시 새로 생성된 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayAttachSharedFd(int fd, int mode)
+{
+	if((fd < 0) || ((mode != MAP_MODE_READ_ONLY) && (mode != MAP_MODE_READ_WRITE)))
+	{
+		PRINT_MSG("잘못된 매개변수. (dynamicIntArrayAttachSharedFd, fd:%d, mode:%d)", ERROR, 2, fd, mode);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return NULL;
+	}
+
+	// 1. 헤더를 읽고 검사한다.
+	dynamicIntArraySharedHeader_t header;
+	struct stat fileStat;
+	if((fstat(fd, &fileStat) != 0) || (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)))
+	{
+		PRINT_MSG("공유 메모리 헤더 읽기 실패. (dynamicIntArrayAttachSharedFd, fd:%d, errno:%d)", ERROR, 2, fd, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return NULL;
+	}
+
+	size_t mapLength = sizeof(dynamicIntArraySharedHeader_t) + ((size_t)header.capacity * sizeof(int));
+	if((memcmp(header.magic, DYNAMIC_INT_ARRAY_SHARED_MAGIC, sizeof(header.magic)) != 0)
+		|| (header.version != DYNAMIC_INT_ARRAY_SHARED_VERSION)
+		|| (header.elementWidth != sizeof(int))
+		|| (header.capacity == 0) || (header.capacity > (uint64_t)DYNAMIC_INT_ARRAY_MAX_SIZE)
+		|| ((size_t)fileStat.st_size < mapLength))
+	{
+		PRINT_MSG("공유 메모리 형식 오류. (dynamicIntArrayAttachSharedFd, fd:%d, capacity:%llu)", ERROR, 2, fd, (unsigned long long)header.capacity);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		return NULL;
+	}
+
+	// 2. 헤더와 용량만큼 공유 매핑한다.
+	int isWritable = (mode == MAP_MODE_READ_WRITE) ? YES : NO;
+	void *mapBase = mmap(NULL, mapLength, (isWritable == YES) ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+	if(mapBase == MAP_FAILED)
+	{
+		PRINT_MSG("공유 메모리 매핑 실패. (dynamicIntArrayAttachSharedFd, fd:%d, errno:%d)", ERROR, 2, fd, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return NULL;
+	}
+
+	const dynamicIntArrayAllocator_t *allocator = defaultAllocator;
+	dynamicIntArray_t *array = (dynamicIntArray_t*)allocator->allocate(allocator->context, sizeof(dynamicIntArray_t));
+	if(checkObjectNull(array, "메모리 생성 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayAttachSharedFd)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+		munmap(mapBase, mapLength);
+		return NULL;
+	}
+
+	array->size = 0;
+	array->capacity = (size_t)header.capacity;
+	array->reservedCapacity = 0;
+	array->growthFactor = DYNAMIC_INT_ARRAY_GROWTH_FACTOR;
+	array->growthMinIncrement = DYNAMIC_INT_ARRAY_GROWTH_MIN_INCREMENT;
+	array->growthMaxSlack = DYNAMIC_INT_ARRAY_GROWTH_MAX_SLACK;
+	array->data = (int*)((char*)mapBase + sizeof(dynamicIntArraySharedHeader_t));
+	array->stringOfArray = NULL;
+	array->stringCapacity = 0;
+	array->storageKind = (isWritable == YES) ? STORAGE_SHARED_READ_WRITE : STORAGE_SHARED_READ_ONLY;
+	array->storageFd = fd;
+	array->storageBase = mapBase;
+	array->storageLength = mapLength;
+	array->storageGeneration = 0;
+	array->adoptedFree = NULL;
+	array->cowBlock = NULL;
+	array->allocator = allocator;
+
+	// 3. 연결하는 동안 게시된 크기 변경을 반영한다.
+	if(dynamicIntArrayRefresh(array) == FAIL)
+	{
+		PRINT_MSG("dynamicIntArrayRefresh 실패. (dynamicIntArrayAttachSharedFd, fd:%d)", DEBUG, 1, fd);
+		munmap(array->storageBase, array->storageLength);
+		allocator->deallocate(allocator->context, array, sizeof(dynamicIntArray_t));
+		return NULL;
+	}
+
+	return array;
+}
+
+/**
+ * @fn int dynamicIntArrayRefresh(dynamicIntArray_t *array)
+ * @brief 공유 메모리 헤더의 세대 번호를 확인해서 다른 프로세스가 게시한 크기와 용량 변경을 반영하는 함수
+ * 세대 번호가 그대로이면 원자적 읽기 한 번으로 끝나므로 읽기 전에 자주 호출해도 된다.
+ * 용량이 늘어났으면 원소를 복사하지 않고 늘어난 공유 메모리를 다시 매핑한다.
+ * 공유 메모리가 아닌 저장소는 반영할 내용이 없으므로 바로 성공한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayRefresh(dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayRefresh)") == YES)
+	{
+		return FAIL;
+	}
+
+	if((array->storageKind != STORAGE_SHARED_READ_ONLY) && (array->storageKind != STORAGE_SHARED_READ_WRITE))
+	{
+		return SUCCESS;
+	}
+
+	const dynamicIntArraySharedHeader_t *header = (const dynamicIntArraySharedHeader_t*)array->storageBase;
+	uint64_t generation = __atomic_load_n(&header->generation, __ATOMIC_ACQUIRE);
+	if((generation == array->storageGeneration) && (array->storageGeneration != 0))
+	{
+		return SUCCESS;
+	}
+
+	uint64_t capacity = __atomic_load_n(&header->capacity, __ATOMIC_RELAXED);
+	uint64_t size = __atomic_load_n(&header->size, __ATOMIC_RELAXED);
+	if(capacity > (uint64_t)DYNAMIC_INT_ARRAY_MAX_SIZE)
+	{
+		PRINT_MSG("공유 메모리 형식 오류. (dynamicIntArrayRefresh, capacity:%llu)", ERROR, 1, (unsigned long long)capacity);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		return FAIL;
+	}
+
+	// 용량은 줄어들지 않으므로 늘어난 경우만 다시 매핑한다. (header 는 다시 매핑하면 무효가 됨)
+	if((size_t)capacity > array->capacity)
+	{
+		if(remapStorage(array, sizeof(dynamicIntArraySharedHeader_t) + ((size_t)capacity * sizeof(int))) == FAIL)
+		{
+			PRINT_MSG("remapStorage 실패. (dynamicIntArrayRefresh, capacity:%llu)", DEBUG, 1, (unsigned long long)capacity);
+			return FAIL;
+		}
+		array->capacity = (size_t)capacity;
+	}
+
+	array->size = (size > (uint64_t)array->capacity) ? array->capacity : (size_t)size;
+	array->storageGeneration = generation;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayGetSharedFd(const dynamicIntArray_t *array)
+ * @brief 공유 메모리 동적 배열의 파일 디스크립터를 반환하는 함수 (다른 프로세스에 전달해서 dynamicIntArrayAttachSharedFd 로 연결)
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 파일 디스크립터, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayGetSharedFd(const dynamicIntArray_t *array)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체가 NULL. (dynamicIntArrayGetSharedFd)") == YES)
+	{
+		return FAIL;
+	}
+
+	if((array->storageKind != STORAGE_SHARED_READ_ONLY) && (array->storageKind != STORAGE_SHARED_READ_WRITE))
+	{
+		PRINT_MSG("공유 메모리 동적 배열이 아님. (dynamicIntArrayGetSharedFd, storageKind:%d)", ERROR, 1, array->storageKind);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	return array->storageFd;
+}
+
+/**
+ * @fn int dynamicIntArrayUnlinkShared(const char *name)
+ * @brief 이름으로 생성한 공유 메모리 객체의 이름을 제거하는 함수
+ * 이미 연결된 동적 배열들은 모두 삭제될 때까지 계속 사용할 수 있다.
+ * @param name 공유 메모리 객체 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayUnlinkShared(const char *name)
+{
+	if(checkObjectNull(name, "메모리 참조 실패, 공유 메모리 이름이 NULL. (dynamicIntArrayUnlinkShared)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(shm_unlink(name) != 0)
+	{
+		PRINT_MSG("공유 메모리 이름 제거 실패. (dynamicIntArrayUnlinkShared, name:%s, errno:%d)", ERROR, 2, name, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for dynamicIntArrayView_t
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int dynamicIntArrayViewOf(const dynamicIntArray_t *array, size_t from, size_t length, dynamicIntArrayView_t *view)
+ * @brief 동적 배열의 지정한 구간을 복사하지 않고 가리키는 읽기 전용 뷰를 생성하는 함수
+ * 힙을 사용하지 않으며, 동적 배열의 용량이 바뀌거나 해제되기 전까지만 사용할 수 있다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param from 구간의 시작 인덱스(입력, 크기와 같으면 빈 뷰)
+ * @param length 구간의 원소 개수(입력)
+ * @param view 생성한 뷰를 저장할 뷰 구조체 포인터(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayViewOf(const dynamicIntArray_t *array, size_t from, size_t length, dynamicIntArrayView_t *view)
+{
+	return initializeArrayView(array, from, length, YES, view, "dynamicIntArrayViewOf");
+}
+
+/**
+ * @fn int dynamicIntArrayViewOfMutable(dynamicIntArray_t *array, size_t from, size_t length, dynamicIntArrayView_t *view)
+ * @brief 동적 배열의 지정한 구간을 복사하지 않고 가리키는 변경 가능한 뷰를 생성하는 함수
+ * 읽기 전용 저장소는 실패하고, copy-on-write 복제본과 원소 저장소를 함께 사용 중이면 먼저 분리한다.
+ * 뷰를 생성한 뒤에 다시 copy-on-write 복제본을 만들면 뷰를 통한 변경이 복제본에도 보이므로 뷰를 다시 생성해야 한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param from 구간의 시작 인덱스(입력, 크기와 같으면 빈 뷰)
+ * @param length 구간의 원소 개수(입력)
+ * @param view 생성한 뷰를 저장할 뷰 구조체 포인터(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayViewOfMutable(dynamicIntArray_t *array, size_t from, size_t length, dynamicIntArrayView_t *view)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayViewOfMutable)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(prepareWrite(array, "dynamicIntArrayViewOfMutable") == FAIL)
+	{
+		return FAIL;
+	}
+
+	return initializeArrayView(array, from, length, NO, view, "dynamicIntArrayViewOfMutable");
+}
+
+/**
+ * @fn int dynamicIntArrayViewFromBuffer(int *data, size_t length, size_t stride, int isReadOnly, dynamicIntArrayView_t *view)
+ * @brief 외부 메모리를 복사하지 않고 가리키는 뷰를 생성하는 함수
+ * 원소 i 는 data[i * stride] 에 있다.
+ * @param data 첫 번째 원소 주소(입력, length 가 0 이면 NULL 가능)
+ * @param length 원소 개수(입력)
+ * @param stride 이웃한 원소 사이의 간격(입력, 원소 개수, 1 이상)
+ * @param isReadOnly 뷰를 통한 변경 금지 여부(입력, YES 또는 NO)
+ * @param view 생성한 뷰를 저장할 뷰 구조체 포인터(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayViewFromBuffer(int *data, size_t length, size_t stride, int isReadOnly, dynamicIntArrayView_t *view)
+{
+	if(checkObjectNull(view, "메모리 참조 실패, 뷰 구조체 포인터가 NULL. (dynamicIntArrayViewFromBuffer)") == YES)
+	{
+		return FAIL;
+	}
+
+	if((length > 0) && (checkObjectNull(data, "메모리 참조 실패, 원소 주소가 NULL. (dynamicIntArrayViewFromBuffer)") == YES))
+	{
+		return FAIL;
+	}
+
+	if((stride == 0) || ((isReadOnly != YES) && (isReadOnly != NO)))
+	{
+		PRINT_MSG("뷰 생성 실패. 간격이 0 이거나 알 수 없는 isReadOnly 값. (dynamicIntArrayViewFromBuffer, stride:%zu, isReadOnly:%d)", ERROR, 2, stride, isReadOnly);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	view->data = data;
+	view->length = length;
+	view->stride = stride;
+	view->isReadOnly = isReadOnly;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayViewSlice(const dynamicIntArrayView_t *view, size_t from, size_t length, size_t step, dynamicIntArrayView_t *slice)
+ * @brief 뷰의 지정한 인덱스부터 step 개마다 하나씩 length 개의 원소를 가리키는 뷰를 생성하는 함수
+ * 새 뷰의 간격은 [기존 간격 * step] 이 되고, 읽기 전용 여부는 그대로 유지된다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param from 새 뷰의 첫 번째 원소가 될 인덱스(입력, 뷰 길이와 같으면 빈 뷰)
+ * @param length 새 뷰의 원소 개수(입력)
+ * @param step 새 뷰에서 이웃한 원소 사이의 인덱스 간격(입력, 1 이상)
+ * @param slice 생성한 뷰를 저장할 뷰 구조체 포인터(출력, view 와 같아도 됨)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayViewSlice(const dynamicIntArrayView_t *view, size_t from, size_t length, size_t step, dynamicIntArrayView_t *slice)
+{
+	if((checkView(view, "dynamicIntArrayViewSlice") == FAIL)
+		|| (checkObjectNull(slice, "메모리 참조 실패, 새 뷰 구조체 포인터가 NULL. (dynamicIntArrayViewSlice)") == YES))
+	{
+		return FAIL;
+	}
+
+	if((step == 0) || (step > (SIZE_MAX / view->stride)))
+	{
+		PRINT_MSG("뷰 생성 실패. 간격 오류. (dynamicIntArrayViewSlice, step:%zu, stride:%zu)", ERROR, 2, step, view->stride);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	// 마지막 원소 인덱스 [from + (length - 1) * step] 이 뷰 길이보다 작아야 한다. (곱셈 오버플로우를 피하려고 나누어서 비교)
+	if((from > view->length) || ((length > 0) && ((from == view->length) || ((length - 1) > ((view->length - 1 - from) / step)))))
+	{
+		PRINT_MSG("뷰 생성 실패. 구간 오류. (dynamicIntArrayViewSlice, from:%zu, length:%zu, step:%zu, viewLength:%zu)", ERROR, 4, from, length, step, view->length);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	int *data = (length > 0) ? (view->data + (from * view->stride)) : NULL;
+	slice->stride = view->stride * step;
+	slice->isReadOnly = view->isReadOnly;
+	slice->length = length;
+	slice->data = data;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayViewGetElement(const dynamicIntArrayView_t *view, size_t index, int *isError)
+ * @brief 뷰의 지정한 인덱스에 있는 값을 반환하는 함수
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param index 지정할 인덱스(입력)
+ * @param isError 함수 실행 결과(출력, 함수 실행 성공 시 SUCCESS, 실패 시 FAIL 저장)
+ * @return 성공 시 지정한 인덱스에 있는 값, 실패 시 NONE 반환
+ */
+int dynamicIntArrayViewGetElement(const dynamicIntArrayView_t *view, size_t index, int *isError)
+{
+	if(checkView(view, "dynamicIntArrayViewGetElement") == FAIL)
+	{
+		*isError = FAIL;
+		return NONE;
+	}
+
+	if(index >= view->length)
+	{
+		PRINT_MSG("Get 실패. 인덱스 오류. (dynamicIntArrayViewGetElement, index:%zu, length:%zu)", ERROR, 2, index, view->length);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		*isError = FAIL;
+		return NONE;
+	}
+
+	*isError = SUCCESS;
+	return view->data[index * view->stride];
+}
+
+/**
+ * @fn size_t dynamicIntArrayViewIndexOf(const dynamicIntArrayView_t *view, int datum)
+ * @brief 뷰에서 지정한 값의 첫 번째 인덱스를 반환하는 함수
+ * 연속된 뷰는 CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 검색된 뷰 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayViewIndexOf(const dynamicIntArrayView_t *view, int datum)
+{
+	if(checkView(view, "dynamicIntArrayViewIndexOf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if(view->stride == 1)
+	{
+		return simdKernels.indexOf(view->data, view->length, datum);
+	}
+
+	const int *viewData = view->data;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < view->length; loopIndex++)
+	{
+		if (viewData[loopIndex * view->stride] == datum)
+		{
+			return loopIndex;
+		}
+	}
+
+	return DYNAMIC_INT_ARRAY_NPOS;
+}
+
+/**
+ * @fn size_t dynamicIntArrayViewLastIndexOf(const dynamicIntArrayView_t *view, int datum)
+ * @brief 뷰에서 지정한 값의 마지막 인덱스를 반환하는 함수
+ * 연속된 뷰는 CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 검색된 뷰 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayViewLastIndexOf(const dynamicIntArrayView_t *view, int datum)
+{
+	if(checkView(view, "dynamicIntArrayViewLastIndexOf") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if(view->stride == 1)
+	{
+		return simdKernels.lastIndexOf(view->data, view->length, datum);
+	}
+
+	const int *viewData = view->data;
+	size_t loopIndex = view->length;
+
+	for (; loopIndex > 0; loopIndex--)
+	{
+		if (viewData[(loopIndex - 1) * view->stride] == datum)
+		{
+			return loopIndex - 1;
+		}
+	}
+
+	return DYNAMIC_INT_ARRAY_NPOS;
+}
+
+/**
+ * @fn size_t dynamicIntArrayViewCount(const dynamicIntArrayView_t *view, int datum)
+ * @brief 뷰에서 지정한 값의 개수를 반환하는 함수
+ * 연속된 뷰는 CPU 에 맞게 선택된 SIMD 검색 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param datum 지정한 값(입력)
+ * @return 성공 시 지정한 값의 개수, 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayViewCount(const dynamicIntArrayView_t *view, int datum)
+{
+	if(checkView(view, "dynamicIntArrayViewCount") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if(view->stride == 1)
+	{
+		return simdKernels.count(view->data, view->length, datum);
+	}
+
+	const int *viewData = view->data;
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < view->length; loopIndex++)
+	{
+		count += (viewData[loopIndex * view->stride] == datum) ? 1 : 0;
+	}
+
+	return count;
+}
+
+/**
+ * @fn size_t dynamicIntArrayViewFind(const dynamicIntArrayView_t *view, compareInt1Param_f func)
+ * @brief 뷰에서 지정한 조건 함수의 조건과 일치하는 값의 첫 번째 인덱스를 반환하는 함수
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @return 성공 시 검색된 뷰 인덱스, 검색 실패 또는 내부 함수 호출 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayViewFind(const dynamicIntArrayView_t *view, compareInt1Param_f func)
+{
+	if(checkView(view, "dynamicIntArrayViewFind") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	if(func == NULL)
+	{
+		PRINT_MSG("메모리 참조 실패, 조건 함수가 NULL. (dynamicIntArrayViewFind)", DEBUG, 0);
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	const int *viewData = view->data;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < view->length; loopIndex++)
+	{
+		if (func(viewData[loopIndex * view->stride]) == YES)
+		{
+			return loopIndex;
+		}
+	}
+
+	return DYNAMIC_INT_ARRAY_NPOS;
+}
+
+/**
+ * @fn int dynamicIntArrayViewReverse(const dynamicIntArrayView_t *view)
+ * @brief 뷰가 가리키는 원소들을 제자리에서 역순으로 저장하는 함수
+ * 연속된 뷰는 CPU 에 맞게 선택된 SIMD 역순 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용, 가리키는 원소들은 변경됨)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayViewReverse(const dynamicIntArrayView_t *view)
+{
+	if(checkWritableView(view, "dynamicIntArrayViewReverse") == FAIL)
+	{
+		return FAIL;
+	}
+
+	if(view->stride == 1)
+	{
+		simdKernels.reverse(view->data, view->length);
+		return SUCCESS;
+	}
+
+	int *viewData = view->data;
+	size_t left = 0;
+	size_t right = view->length;
+
+	for (; left + 1 < right; left++, right--)
+	{
+		int temp = viewData[left * view->stride];
+		viewData[left * view->stride] = viewData[(right - 1) * view->stride];
+		viewData[(right - 1) * view->stride] = temp;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayViewFill(const dynamicIntArrayView_t *view, int datum)
+ * @brief 뷰가 가리키는 원소들을 특정 값으로 채우는 함수
+ * 연속된 뷰는 dynamicIntArrayFill 과 같은 SIMD 채우기 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용, 가리키는 원소들은 변경됨)
+ * @param datum 채울 값(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayViewFill(const dynamicIntArrayView_t *view, int datum)
+{
+	if(checkWritableView(view, "dynamicIntArrayViewFill") == FAIL)
+	{
+		return FAIL;
+	}
+
+	if(view->stride == 1)
+	{
+		simdFill(view->data, view->length, datum);
+		return SUCCESS;
+	}
+
+	int *viewData = view->data;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < view->length; loopIndex++)
+	{
+		viewData[loopIndex * view->stride] = datum;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayViewSum(const dynamicIntArrayView_t *view, int64_t *sum)
+ * @brief 뷰가 가리키는 원소들의 합을 구하는 함수
+ * 64 비트로 누적하므로 원소가 2^32 개 미만이면 넘치지 않는다. 연속된 뷰는 CPU 에 맞게 선택된 SIMD 합 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param sum 원소들의 합(출력, 빈 뷰이면 0)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayViewSum(const dynamicIntArrayView_t *view, int64_t *sum)
+{
+	if(checkView(view, "dynamicIntArrayViewSum") == FAIL)
+	{
+		return FAIL;
+	}
+
+	if(checkObjectNull(sum, "메모리 참조 실패, 합을 저장할 포인터가 NULL. (dynamicIntArrayViewSum)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	*sum = sumViewElements(view);
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayViewMin(const dynamicIntArrayView_t *view, int *min)
+ * @brief 뷰가 가리키는 원소들의 최솟값을 구하는 함수
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param min 최솟값(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 뷰이면 FAIL 반환
+ */
+int dynamicIntArrayViewMin(const dynamicIntArrayView_t *view, int *min)
+{
+	int max = 0;
+
+	if(checkObjectNull(min, "메모리 참조 실패, 최솟값을 저장할 포인터가 NULL. (dynamicIntArrayViewMin)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	return reduceViewMinMax(view, min, &max, "dynamicIntArrayViewMin");
+}
+
+/**
+ * @fn int dynamicIntArrayViewMax(const dynamicIntArrayView_t *view, int *max)
+ * @brief 뷰가 가리키는 원소들의 최댓값을 구하는 함수
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param max 최댓값(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 뷰이면 FAIL 반환
+ */
+int dynamicIntArrayViewMax(const dynamicIntArrayView_t *view, int *max)
+{
+	int min = 0;
+
+	if(checkObjectNull(max, "메모리 참조 실패, 최댓값을 저장할 포인터가 NULL. (dynamicIntArrayViewMax)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	return reduceViewMinMax(view, &min, max, "dynamicIntArrayViewMax");
+}
+
+/**
+ * @fn int dynamicIntArrayViewMinMax(const dynamicIntArrayView_t *view, int *min, int *max)
+ * @brief 뷰가 가리키는 원소들의 최솟값과 최댓값을 한 번의 순회로 함께 구하는 함수
+ * 연속된 뷰는 CPU 에 맞게 선택된 SIMD 최솟값/최댓값 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param min 최솟값(출력)
+ * @param max 최댓값(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 뷰이면 FAIL 반환
+ */
+int dynamicIntArrayViewMinMax(const dynamicIntArrayView_t *view, int *min, int *max)
+{
+	if((checkObjectNull(min, "메모리 참조 실패, 최솟값을 저장할 포인터가 NULL. (dynamicIntArrayViewMinMax)") == YES)
+		|| (checkObjectNull(max, "메모리 참조 실패, 최댓값을 저장할 포인터가 NULL. (dynamicIntArrayViewMinMax)") == YES))
+	{
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	return reduceViewMinMax(view, min, max, "dynamicIntArrayViewMinMax");
+}
+
+/**
+ * @fn size_t dynamicIntArrayViewArgMin(const dynamicIntArrayView_t *view)
+ * @brief 뷰에서 최솟값을 가진 첫 번째 원소의 인덱스를 반환하는 함수
+ * 최솟값을 SIMD 커널로 구한 뒤 같은 값을 SIMD 검색 커널로 찾는다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 최솟값의 첫 번째 뷰 인덱스, 실패 또는 빈 뷰이면 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayViewArgMin(const dynamicIntArrayView_t *view)
+{
+	int min = 0;
+	int max = 0;
+
+	if(reduceViewMinMax(view, &min, &max, "dynamicIntArrayViewArgMin") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return dynamicIntArrayViewIndexOf(view, min);
+}
+
+/**
+ * @fn size_t dynamicIntArrayViewArgMax(const dynamicIntArrayView_t *view)
+ * @brief 뷰에서 최댓값을 가진 첫 번째 원소의 인덱스를 반환하는 함수
+ * 최댓값을 SIMD 커널로 구한 뒤 같은 값을 SIMD 검색 커널로 찾는다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @return 성공 시 최댓값의 첫 번째 뷰 인덱스, 실패 또는 빈 뷰이면 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+size_t dynamicIntArrayViewArgMax(const dynamicIntArrayView_t *view)
+{
+	int min = 0;
+	int max = 0;
+
+	if(reduceViewMinMax(view, &min, &max, "dynamicIntArrayViewArgMax") == FAIL)
+	{
+		return DYNAMIC_INT_ARRAY_NPOS;
+	}
+
+	return dynamicIntArrayViewIndexOf(view, max);
+}
+
+/**
+ * @fn int dynamicIntArrayViewMean(const dynamicIntArrayView_t *view, double *mean)
+ * @brief 뷰가 가리키는 원소들의 평균을 구하는 함수
+ * 합을 64 비트로 누적한 뒤 원소 개수로 나눈다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param mean 원소들의 평균(출력)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 뷰이면 FAIL 반환
+ */
+int dynamicIntArrayViewMean(const dynamicIntArrayView_t *view, double *mean)
+{
+	if(checkView(view, "dynamicIntArrayViewMean") == FAIL)
+	{
+		return FAIL;
+	}
+
+	if(checkObjectNull(mean, "메모리 참조 실패, 평균을 저장할 포인터가 NULL. (dynamicIntArrayViewMean)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	if(view->length == 0)
+	{
+		PRINT_MSG("빈 뷰의 평균은 구할 수 없음. (dynamicIntArrayViewMean)", ERROR, 0);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	*mean = (double)sumViewElements(view) / (double)view->length;
+	return SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for dynamicIntArrayParser_t
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int dynamicIntArrayParserInitialize(dynamicIntArrayParser_t *parser)
+ * @brief 문자열 파서 구조체를 초기화하는 함수
+ * @param parser 문자열 파서 구조체 포인터(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayParserInitialize(dynamicIntArrayParser_t *parser)
+{
+	if(checkObjectNull(parser, "메모리 참조 실패, 문자열 파서 구조체 포인터가 NULL. (dynamicIntArrayParserInitialize)") == YES)
+	{
+		return FAIL;
+	}
+
+	parser->array = NULL;
+	parser->state = PARSE_STATE_OPEN;
+	parser->isNegative = NO;
+	parser->digitCount = 0;
+	parser->value = 0;
+	parser->offset = 0;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayParserFeed(dynamicIntArrayParser_t *parser, const char *text, size_t length)
+ * @brief 문자열 조각을 전달받아 이어서 변환하는 함수
+ * 숫자나 공백이 조각 경계에 걸쳐 있어도 되므로 read 로 읽은 조각을 그대로 전달하면 된다.
+ * 조각마다 SIMD 커널로 쉼표 개수를 세어 필요한 용량을 한 번에 확보한다.
+ * @param parser 문자열 파서 구조체 포인터(입력, 출력)
+ * @param text 변환할 문자열 조각(입력, 읽기 전용)
+ * @param length 문자열 조각 길이(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayParserFeed(dynamicIntArrayParser_t *parser, const char *text, size_t length)
+{
+	if(checkObjectNull(parser, "메모리 참조 실패, 문자열 파서 구조체 포인터가 NULL. (dynamicIntArrayParserFeed)") == YES)
+	{
+		return FAIL;
+	}
+
+	if((length > 0) && (checkObjectNull(text, "메모리 참조 실패, 문자열 조각이 NULL. (dynamicIntArrayParserFeed)") == YES))
+	{
+		return FAIL;
+	}
+
+	if(parser->state == PARSE_STATE_ERROR)
+	{
+		PRINT_MSG("이미 형식 오류가 발생한 파서. (dynamicIntArrayParserFeed, offset:%zu)", ERROR, 1, parser->offset);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		return FAIL;
+	}
+
+	// 1. 조각 안에서 완성되는 숫자는 쉼표 개수 + 1 개를 넘지 않으므로 그만큼의 용량을 미리 확보한다.
+	if(parser->state != PARSE_STATE_CLOSED)
+	{
+		size_t commaCount = simdKernels.countByte(text, length, ',');
+		size_t currentSize = (parser->array == NULL) ? 0 : parser->array->size;
+		if(commaCount >= (DYNAMIC_INT_ARRAY_MAX_SIZE - currentSize))
+		{
+			PRINT_MSG("원소 개수 오류. 최대 원소 개수 초과. (dynamicIntArrayParserFeed, size:%zu, commaCount:%zu)", ERROR, 2, currentSize, commaCount);
+			dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+			parser->state = PARSE_STATE_ERROR;
+			return FAIL;
+		}
+
+		size_t requiredSize = currentSize + commaCount + 1;
+		if(parser->array == NULL)
+		{
+			parser->array = newWithCapacity(0, requiredSize, defaultAllocator, "dynamicIntArrayParserFeed");
+			if(checkObjectNull(parser->array, "메모리 생성 실패, 변환할 동적 배열이 NULL. (dynamicIntArrayParserFeed)") == YES)
+			{
+				parser->state = PARSE_STATE_ERROR;
+				return FAIL;
+			}
+		}
+		else if(growCapacity(parser->array, requiredSize) == FAIL)
+		{
+			PRINT_MSG("메모리 재생성 실패. growCapacity 실패. (dynamicIntArrayParserFeed)", DEBUG, 0);
+			parser->state = PARSE_STATE_ERROR;
+			return FAIL;
+		}
+	}
+
+	// 2. 상태에 따라 한 문자씩 변환한다. 숫자는 8 자리씩 한 번에 변환할 수 있다.
+	dynamicIntArray_t *array = parser->array;
+	size_t loopIndex = 0;
+	while(loopIndex < length)
+	{
+		char character = text[loopIndex];
+		switch(parser->state)
+		{
+			case PARSE_STATE_NUMBER:
+				if((character >= '0') && (character <= '9'))
+				{
+					if((PARSE_USE_SWAR == 1) && ((length - loopIndex) >= 8) && (isEightDigits(text + loopIndex) == YES))
+					{
+						parser->value = (parser->value * 100000000ULL) + parseEightDigits(text + loopIndex);
+						parser->digitCount += 8;
+						loopIndex += 8;
+					}
+					else
+					{
+						parser->value = (parser->value * 10ULL) + (unsigned long long)(character - '0');
+						parser->digitCount++;
+						loopIndex++;
+					}
+
+					if(parser->value > ((parser->isNegative == YES) ? (unsigned long long)INT_MAX + 1ULL : (unsigned long long)INT_MAX))
+					{
+						return parserFail(parser, loopIndex, "정수 범위 초과");
+					}
+					continue;
+				}
+
+				if(parser->digitCount == 0)
+				{
+					return parserFail(parser, loopIndex, "부호 다음에 숫자가 없음");
+				}
+
+				array->data[array->size++] = (parser->isNegative == YES) ? (int)(-(long long)parser->value) : (int)parser->value;
+				parser->state = PARSE_STATE_SEPARATOR;
+				// 숫자를 끝낸 문자는 SEPARATOR 상태에서 다시 처리한다.
+				continue;
+
+			case PARSE_STATE_OPEN:
+				if(character == '{') parser->state = PARSE_STATE_FIRST;
+				else if(isSpaceCharacter(character) == NO) return parserFail(parser, loopIndex, "여는 중괄호가 없음");
+				break;
+
+			case PARSE_STATE_FIRST:
+			case PARSE_STATE_VALUE:
+				if((character == '-') || ((character >= '0') && (character <= '9')))
+				{
+					parser->isNegative = (character == '-') ? YES : NO;
+					parser->digitCount = 0;
+					parser->value = 0;
+					parser->state = PARSE_STATE_NUMBER;
+					if(character != '-') continue;
+				}
+				else if((character == '}') && (parser->state == PARSE_STATE_FIRST)) parser->state = PARSE_STATE_CLOSED;
+				else if(isSpaceCharacter(character) == NO) return parserFail(parser, loopIndex, "숫자가 없음");
+				break;
+
+			case PARSE_STATE_SEPARATOR:
+				if(character == ',') parser->state = PARSE_STATE_VALUE;
+				else if(character == '}') parser->state = PARSE_STATE_CLOSED;
+				else if(isSpaceCharacter(character) == NO) return parserFail(parser, loopIndex, "쉼표 또는 닫는 중괄호가 없음");
+				break;
+
+			default:
+				if(isSpaceCharacter(character) == NO) return parserFail(parser, loopIndex, "닫는 중괄호 다음에 문자가 있음");
+				break;
+		}
+		loopIndex++;
+	}
+
+	parser->offset += length;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn dynamicIntArray_t *dynamicIntArrayParserFinish(dynamicIntArrayParser_t *parser)
+ * @brief 문자열 변환을 끝내고 변환한 동적 배열을 반환하는 함수
+ * 반환된 동적 배열은 호출자가 관리하며, 파서는 다시 사용할 수 있도록 초기화된다.
+ * 닫는 중괄호까지 전달받지 못했으면 변환 중인 동적 배열을 해제하고 실패한다.
+ * @param parser 문자열 파서 구조체 포인터(입력, 출력)
+ * @return 성공 시 변환한 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+dynamicIntArray_t *dynamicIntArrayParserFinish(dynamicIntArrayParser_t *parser)
+{
+	if(checkObjectNull(parser, "메모리 참조 실패, 문자열 파서 구조체 포인터가 NULL. (dynamicIntArrayParserFinish)") == YES)
+	{
+		return NULL;
+	}
+
+	if(parser->state != PARSE_STATE_CLOSED)
+	{
+		if(parser->state != PARSE_STATE_ERROR)
+		{
+			PRINT_MSG("문자열 형식 오류. 닫는 중괄호 없이 끝남. (dynamicIntArrayParserFinish, offset:%zu)", ERROR, 1, parser->offset);
+			dynamicIntArraySetLastError(ERROR_FORMAT);
+		}
+		dynamicIntArrayParserFinal(parser);
+		return NULL;
+	}
+
+	dynamicIntArray_t *array = parser->array;
+	parser->array = NULL;
+	dynamicIntArrayParserInitialize(parser);
+
+	return array;
+}
+
+/**
+ * @fn int dynamicIntArrayParserFinal(dynamicIntArrayParser_t *parser)
+ * @brief 문자열 변환을 중단하고 변환 중인 동적 배열을 해제하는 함수
+ * @param parser 문자열 파서 구조체 포인터(입력, 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayParserFinal(dynamicIntArrayParser_t *parser)
+{
+	if(checkObjectNull(parser, "메모리 참조 실패, 문자열 파서 구조체 포인터가 NULL. (dynamicIntArrayParserFinal)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(parser->array != NULL)
+	{
+		dynamicIntArrayDelete(&(parser->array));
+	}
+
+	return dynamicIntArrayParserInitialize(parser);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for dynamicIntArrayArena_t, dynamicIntArrayPool_t
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int dynamicIntArrayArenaInitialize(dynamicIntArrayArena_t *arena, size_t blockSize)
+ * @brief 아레나 할당자를 초기화하는 함수
+ * 초기화한 뒤 &arena->allocator 를 dynamicIntArrayNewWithAllocator 나 dynamicIntArraySetDefaultAllocator 에 지정한다.
+ * 아레나 할당자는 잠금을 사용하지 않으므로 한 쓰레드에서만 사용해야 한다.
+ * @param arena 아레나 할당자 구조체 포인터(출력)
+ * @param blockSize 블록 크기(입력, 바이트, 0 이면 DYNAMIC_INT_ARRAY_ARENA_BLOCK_SIZE)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayArenaInitialize(dynamicIntArrayArena_t *arena, size_t blockSize)
+{
+	if(checkObjectNull(arena, "메모리 참조 실패, 아레나 할당자 구조체 포인터가 NULL. (dynamicIntArrayArenaInitialize)") == YES)
+	{
+		return FAIL;
+	}
+
+	if(blockSize > (SIZE_MAX / 2))
+	{
+		PRINT_MSG("블록 크기 오류. (dynamicIntArrayArenaInitialize, blockSize:%zu)", ERROR, 1, blockSize);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	arena->allocator.allocate = arenaAllocate;
+	arena->allocator.reallocate = arenaReallocate;
+	arena->allocator.deallocate = arenaDeallocate;
+	arena->allocator.context = arena;
+	arena->blocks = NULL;
+	arena->blockSize = ALLOCATOR_ALIGN_UP((blockSize > 0) ? blockSize : DYNAMIC_INT_ARRAY_ARENA_BLOCK_SIZE);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn void dynamicIntArrayArenaReset(dynamicIntArrayArena_t *arena)
+ * @brief 아레나 할당자로 할당한 모든 메모리를 한 번에 해제하는 함수
+ * 마지막 블록 하나는 해제하지 않고 비워서 다음 할당에 재사용한다.
+ * 이 아레나로 생성한 동적 배열들은 모두 무효가 되므로 다시 사용하거나 dynamicIntArrayDelete 로 해제하면 안 된다.
+ * @param arena 아레나 할당자 구조체 포인터(입력, 출력)
+ * @return 반환값 없음
+ */
+void dynamicIntArrayArenaReset(dynamicIntArrayArena_t *arena)
+{
+	if(checkObjectNull(arena, "메모리 참조 실패, 아레나 할당자 구조체 포인터가 NULL. (dynamicIntArrayArenaReset)") == YES)
+	{
+		return;
+	}
+
+	dynamicIntArrayArenaBlock_t *block = arena->blocks;
+	if(block == NULL)
+	{
+		return;
+	}
+
+	dynamicIntArrayArenaBlock_t *next = block->next;
+	while(next != NULL)
+	{
+		dynamicIntArrayArenaBlock_t *nextOfNext = next->next;
+		free(next);
+		next = nextOfNext;
+	}
+
+	block->next = NULL;
+	block->used = 0;
+}
+
+/**
+ * @fn int dynamicIntArrayArenaFinal(dynamicIntArrayArena_t *arena)
+ * @brief 아레나 할당자의 모든 블록을 해제하는 함수
+ * @param arena 아레나 할당자 구조체 포인터(입력, 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayArenaFinal(dynamicIntArrayArena_t *arena)
+{
+	if(checkObjectNull(arena, "메모리 참조 실패, 아레나 할당자 구조체 포인터가 NULL. (dynamicIntArrayArenaFinal)") == YES)
+	{
+		return FAIL;
+	}
+
+	dynamicIntArrayArenaBlock_t *block = arena->blocks;
+	while(block != NULL)
+	{
+		dynamicIntArrayArenaBlock_t *next = block->next;
+		free(block);
+		block = next;
+	}
+	arena->blocks = NULL;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int dynamicIntArrayPoolInitialize(dynamicIntArrayPool_t *pool)
+ * @brief 풀 할당자를 초기화하는 함수
+ * 초기화한 뒤 &pool->allocator 를 dynamicIntArrayNewWithAllocator 나 dynamicIntArraySetDefaultAllocator 에 지정한다.
+ * 풀 할당자는 잠금을 사용하지 않으므로 한 쓰레드에서만 사용해야 한다.
+ * @param pool 풀 할당자 구조체 포인터(출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayPoolInitialize(dynamicIntArrayPool_t *pool)
+{
+	if(checkObjectNull(pool, "메모리 참조 실패, 풀 할당자 구조체 포인터가 NULL. (dynamicIntArrayPoolInitialize)") == YES)
+	{
+		return FAIL;
+	}
+
+	pool->allocator.allocate = poolAllocate;
+	pool->allocator.reallocate = poolReallocate;
+	pool->allocator.deallocate = poolDeallocate;
+	pool->allocator.context = pool;
+	memset(pool->freeLists, 0, sizeof(pool->freeLists));
+	pool->slabs = NULL;
+	pool->larges = NULL;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn void dynamicIntArrayPoolReset(dynamicIntArrayPool_t *pool)
+ * @brief 풀 할당자로 할당한 모든 메모리를 한 번에 해제하는 함수
+ * 마지막 slab 하나는 해제하지 않고 비워서 다음 할당에 재사용한다.
+ * 이 풀로 생성한 동적 배열들은 모두 무효가 되므로 다시 사용하거나 dynamicIntArrayDelete 로 해제하면 안 된다.
+ * @param pool 풀 할당자 구조체 포인터(입력, 출력)
+ * @return 반환값 없음
+ */
+void dynamicIntArrayPoolReset(dynamicIntArrayPool_t *pool)
+{
+	if(checkObjectNull(pool, "메모리 참조 실패, 풀 할당자 구조체 포인터가 NULL. (dynamicIntArrayPoolReset)") == YES)
+	{
+		return;
+	}
+
+	dynamicIntArrayPoolLarge_t *large = pool->larges;
+	while(large != NULL)
+	{
+		dynamicIntArrayPoolLarge_t *next = large->next;
+		free(large);
+		large = next;
+	}
+	pool->larges = NULL;
+
+	if(pool->slabs != NULL)
+	{
+		dynamicIntArrayPoolSlab_t *slab = pool->slabs->next;
+		while(slab != NULL)
+		{
+			dynamicIntArrayPoolSlab_t *next = slab->next;
+			free(slab);
+			slab = next;
+		}
+		pool->slabs->next = NULL;
+		pool->slabs->used = 0;
+	}
+
+	memset(pool->freeLists, 0, sizeof(pool->freeLists));
+}
+
+/**
+ * @fn int dynamicIntArrayPoolFinal(dynamicIntArrayPool_t *pool)
+ * @brief 풀 할당자의 모든 slab 과 큰 메모리를 해제하는 함수
+ * @param pool 풀 할당자 구조체 포인터(입력, 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int dynamicIntArrayPoolFinal(dynamicIntArrayPool_t *pool)
+{
+	if(checkObjectNull(pool, "메모리 참조 실패, 풀 할당자 구조체 포인터가 NULL. (dynamicIntArrayPoolFinal)") == YES)
+	{
+		return FAIL;
+	}
+
+	dynamicIntArrayPoolReset(pool);
+	free(pool->slabs);
+	pool->slabs = NULL;
+
+	return SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Common Util Functions
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void printMsg(const char *msg, int type, int argc, ...)
+ * @brief 메시지를 출력하는 함수
+ * 출력 수준(printSetLevel)에 의해 걸러지는 메시지는 형식화하지 않고 바로 반환한다.
+ * 메시지는 현재 쓰레드의 출력 링 버퍼 슬롯에 한 번만 형식화되고,
+ * 버퍼링 모드(printSetBuffered)가 아니면 바로 출력 sink(printSetSink)로 전달된다.
+ * @param msg 출력할 문자열(입력, 읽기 전용)
+ * @param type 출력 형태(입력, PRINT_TYPE 열거형 참고)
+ * @param argc 가변 인자 개수(입력)
+ * @return 반환값 없음
+ */
+void printMsg(const char *msg, int type, int argc, ...)
+{
+	if((type < ERROR) || (type > DEBUG))
+	{
+		printDiagnosticMsg("출력 실패. 알 수 없는 메시지 타입. (printMsg, type:%d)", type);
+		return;
+	}
+
+	if((PRINT_IS_ENABLED_AT_COMPILE(type) == NO) || (printIsEnabled(type) == NO))
+	{
+		return;
+	}
+
+	if(argc < 0)
+	{
+		printDiagnosticMsg("출력 실패. 출력문 매개변수 개수가 음수. (printMsg, argc:%d)", argc);
+		return;
+	}
+
+	if(msg == NULL)
+	{
+		printDiagnosticMsg("출력 실패. 메시지 문자열이 NULL. (printMsg)");
+		return;
+	}
+
+	va_list argPointer;
+	va_start(argPointer, argc);
+	printRecordMsg(type, msg, argPointer);
+	va_end(argPointer);
+}
+
+/**
+ * @fn void printSetLevel(int level)
+ * @brief 실행 중에 출력할 메시지의 수준을 설정하는 함수
+ * 지정한 수준보다 상세한(값이 큰) 메시지는 형식화 없이 버려진다.
+ * QUIET 이면 모든 메시지를 출력하지 않는다.
+ * @param level 출력 수준(입력, QUIET, ERROR, NORMAL, DEBUG 중 하나)
+ * @return 반환값 없음
+ */
+void printSetLevel(int level)
+{
+	if((level < QUIET) || (level > DEBUG))
+	{
+		PRINT_MSG("출력 수준 설정 실패. 알 수 없는 출력 수준. (printSetLevel, level:%d)", ERROR, 1, level);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return;
+	}
+
+	atomic_store_explicit(&printRuntimeLevel, level, memory_order_relaxed);
+}
+
+/**
+ * @fn int printGetLevel(void)
+ * @brief 실행 중에 출력할 메시지의 수준을 반환하는 함수
+ * @return 현재 출력 수준 반환
+ */
+int printGetLevel(void)
+{
+	return atomic_load_explicit(&printRuntimeLevel, memory_order_relaxed);
+}
+
+/**
+ * @fn void printSetSink(printSink_f sink, void *context)
+ * @brief 형식화된 메시지를 전달받을 출력 sink 를 설정하는 함수
+ * 쓰레드들이 메시지를 출력하기 전에 설정해야 한다.
+ * @param sink 출력 sink 함수(입력, NULL 이면 기본 sink(표준 출력) 사용)
+ * @param context sink 함수에 전달할 사용자 데이터(입력)
+ * @return 반환값 없음
+ */
+void printSetSink(printSink_f sink, void *context)
+{
+	atomic_store_explicit(&printSinkContext, (sink != NULL) ? context : NULL, memory_order_relaxed);
+	atomic_store_explicit(&printSink, (sink != NULL) ? sink : printDefaultSink, memory_order_release);
+}
+
+/**
+ * @fn void printSetBuffered(int isBuffered)
+ * @brief 출력 링 버퍼 버퍼링 모드를 설정하는 함수
+ * 버퍼링 모드에서는 메시지가 쓰레드별 링 버퍼에 쌓이고, 링 버퍼가 가득 차거나
+ * printFlush 를 호출할 때만 sink 로 전달된다. 버퍼링 모드를 끄면 현재 쓰레드의 링 버퍼를 비운다.
+ * @param isBuffered 버퍼링 여부(입력, YES 또는 NO)
+ * @return 반환값 없음
+ */
+void printSetBuffered(int isBuffered)
+{
+	if((isBuffered != YES) && (isBuffered != NO))
+	{
+		PRINT_MSG("버퍼링 모드 설정 실패. 알 수 없는 isBuffered 변수 값 사용. (printSetBuffered, isBuffered:%d)", ERROR, 1, isBuffered);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return;
+	}
+
+	atomic_store_explicit(&printIsBuffered, isBuffered, memory_order_relaxed);
+	if(isBuffered == NO)
+	{
+		printFlush();
+	}
+}
+
+/**
+ * @fn void printFlush(void)
+ * @brief 현재 쓰레드의 출력 링 버퍼에 쌓인 메시지를 오래된 순서대로 모두 sink 로 전달하는 함수
+ * 링 버퍼는 쓰레드마다 따로 있으므로 잠금 없이 동작한다.
+ * 버퍼링 모드에서 쌓인 메시지는 쓰레드가 끝날 때와 프로세스가 종료될 때(exit)에도 자동으로 전달된다.
+ * @return 반환값 없음
+ */
+void printFlush(void)
+{
+	flushPrintRing(&printThreadRing);
+}
+
+/**
+ * @fn int dynamicIntArrayGetLastError(void)
+ * @brief 현재 쓰레드에서 마지막으로 발생한 오류 코드를 반환하는 함수
+ * 문자열 형식화 없이 실패 원인을 확인할 수 있다.
+ * 성공한 함수 호출은 오류 코드를 지우지 않으므로 필요하면 호출 전에 dynamicIntArrayClearLastError 를 호출한다.
+ * @return 마지막 오류 코드 반환 (ERROR_CODE 열거형 참고)
+ */
+int dynamicIntArrayGetLastError(void)
+{
+	return lastErrorCode;
+}
+
+/**
+ * @fn void dynamicIntArraySetLastError(int errorCode)
+ * @brief 현재 쓰레드의 마지막 오류 코드를 저장하는 함수
+ * @param errorCode 저장할 오류 코드(입력, ERROR_CODE 열거형 참고)
+ * @return 반환값 없음
+ */
+void dynamicIntArraySetLastError(int errorCode)
+{
+	lastErrorCode = errorCode;
+}
+
+/**
+ * @fn void dynamicIntArrayClearLastError(void)
+ * @brief 현재 쓰레드의 마지막 오류 코드를 ERROR_NONE 으로 지우는 함수
+ * @return 반환값 없음
+ */
+void dynamicIntArrayClearLastError(void)
+{
+	lastErrorCode = ERROR_NONE;
+}
+
+/**
+ * @fn const char *dynamicIntArrayGetErrorString(int errorCode)
+ * @brief 오류 코드를 설명하는 문자열을 반환하는 함수
+ * @param errorCode 오류 코드(입력, ERROR_CODE 열거형 참고)
+ * @return 항상 오류 코드를 설명하는 정적 문자열 반환
+ */
+const char *dynamicIntArrayGetErrorString(int errorCode)
+{
+	switch(errorCode)
+	{
+		case ERROR_NONE:				return "오류 없음";
+		case ERROR_NULL_REFERENCE:		return "NULL 참조";
+		case ERROR_OUT_OF_RANGE:		return "인덱스 바운더리 오류";
+		case ERROR_INVALID_ARGUMENT:	return "잘못된 매개변수";
+		case ERROR_OUT_OF_MEMORY:		return "메모리 할당 실패";
+		case ERROR_IO:					return "입출력 오류";
+		case ERROR_FORMAT:				return "문자열 또는 파일 형식 오류";
+		case ERROR_CHECKSUM:			return "체크섬 불일치";
+		case ERROR_READ_ONLY:			return "읽기 전용 동적 배열 변경 시도";
+		default:						return "알 수 없는 오류";
+	}
+}
+
+/**
+ * @fn int checkObjectNull(const void *object, const char *msg)
+ * @brief 객체가 NULL 인지 검사하는 함수
+ * @param object 검사할 객체(입력, 읽기 전용)
+ * @param msg 출력할 오류 문자열(입력, 읽기 전용)
+ * @return NULL 이 아니면 NO, NULL 이면 YES 반환
+ */
+int checkObjectNull(const void *object, const char *msg)
+{
+	if (object == NULL)
+	{
+		// 오류 메시지를 지정한 경우에만 NULL 이 실패 원인이므로 오류 코드를 저장한다.
+		if(msg != NULL)
+		{
+			dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+			PRINT_MSG(msg, DEBUG, 0);
+		}
+		return YES;
+	}
+	return NO;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// Static Util Functions
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static size_t getDigitOfNumber(int number)
+ * @brief 정수의 자리수를 계산해서 반환하는 함수
+ * 음수이면 '-' 부호도 자리수에 포함한다.
+ * @param number 자리수를 계산할 정수(입력)
+ * @return 항상 숫자의 자리수 반환
+ */
+static size_t getDigitOfNumber(int number)
+{
+	size_t countOfDigit = (number < 0) ? 1U : 0U;
+	unsigned int value = (number < 0) ? (0U - (unsigned int)number) : (unsigned int)number;
+
+	if(value < 10U) return countOfDigit + 1;
+	if(value < 100U) return countOfDigit + 2;
+	if(value < 1000U) return countOfDigit + 3;
+	if(value < 10000U) return countOfDigit + 4;
+	if(value < 100000U) return countOfDigit + 5;
+	if(value < 1000000U) return countOfDigit + 6;
+	if(value < 10000000U) return countOfDigit + 7;
+	if(value < 100000000U) return countOfDigit + 8;
+	if(value < 1000000000U) return countOfDigit + 9;
+	return countOfDigit + 10;
+}
+
+/**
+ * @fn static size_t formatNumber(char *buf, int number)
+ * @brief 정수를 10 진수 문자열로 변환하는 함수
+ * 두 자리 숫자 문자 테이블을 사용해서 나눗셈 한 번에 두 자리씩 변환하며, 널 문자는 붙이지 않는다.
+ * @param buf 변환한 문자열을 저장할 버퍼(출력, 11 바이트 이상)
+ * @param number 변환할 정수(입력)
+ * @return 항상 저장한 문자열 길이 반환
+ */
+static size_t formatNumber(char *buf, int number)
+{
+	unsigned int value = (number < 0) ? (0U - (unsigned int)number) : (unsigned int)number;
+	char digits[10];
+	char *digitsEnd = digits + sizeof(digits);
+	char *cursor = digitsEnd;
+
+	while(value >= 100U)
+	{
+		unsigned int pairIndex = (value % 100U) * 2U;
+		value /= 100U;
+		cursor -= 2;
+		memcpy(cursor, digitPairTable + pairIndex, 2);
+	}
+
+	if(value >= 10U)
+	{
+		cursor -= 2;
+		memcpy(cursor, digitPairTable + (value * 2U), 2);
+	}
+	else
+	{
+		*--cursor = (char)('0' + value);
+	}
+
+	size_t length = 0;
+	if(number < 0) buf[length++] = '-';
+
+	size_t digitLength = (size_t)(digitsEnd - cursor);
+	memcpy(buf + length, cursor, digitLength);
+
+	return length + digitLength;
+}
+
+/**
+ * @fn static size_t getFormattedLength(const int *data, size_t size)
+ * @brief 배열을 "{ 1, 2, 3 }" 형식의 문자열로 형식화했을 때의 길이를 계산하는 함수
+ * @param data 형식화할 배열(입력, 읽기 전용)
+ * @param size 배열의 원소 개수(입력)
+ * @return 항상 문자열 길이 반환 (널 문자 제외)
+ */
+static size_t getFormattedLength(const int *data, size_t size)
+{
+	// [총 길이] = [중괄호와 닫는 괄호 앞 공백 (3)] + [원소마다 앞 공백 (size)] + [쉼표 (size - 1)] + [모든 원소들의 자리수 합]
+	size_t length = 3;
+	size_t loopIndex = 0;
+
+	for( ; loopIndex < size; loopIndex++)
+	{
+		length += getDigitOfNumber(data[loopIndex]) + 2;
+	}
+	if(size > 0) length--;
+
+	return length;
+}
+
+/**
+ * @fn static ssize_t formatArray(const int *data, size_t size, formatSink_f sink, void *context)
+ * @brief 배열을 "{ 1, 2, 3 }" 형식의 문자열로 형식화해서 조각 단위로 sink 에 전달하는 함수
+ * DYNAMIC_INT_ARRAY_FORMAT_CHUNK_SIZE 크기의 지역 버퍼에 형식화하고 가득 차면 sink 로 내보내므로
+ * 배열 크기와 관계없이 추가 메모리를 할당하지 않는다.
+ * @param data 형식화할 배열(입력, 읽기 전용)
+ * @param size 배열의 원소 개수(입력)
+ * @param sink 형식화된 문자열 조각을 전달받을 함수(입력)
+ * @param context sink 에 전달할 사용자 정의 데이터(입력)
+ * @return 성공 시 전체 문자열 길이, 실패 시 FAIL 반환
+ */
+static ssize_t formatArray(const int *data, size_t size, formatSink_f sink, void *context)
+{
+	char chunk[DYNAMIC_INT_ARRAY_FORMAT_CHUNK_SIZE];
+	size_t chunkLength = 0;
+	size_t totalLength = 0;
+	size_t loopIndex = 0;
+
+	chunk[chunkLength++] = '{';
+	for( ; loopIndex < size; loopIndex++)
+	{
+		if(chunkLength > (sizeof(chunk) - FORMAT_ELEMENT_MAX_LENGTH))
+		{
+			if(sink(chunk, chunkLength, context) == FAIL) return FAIL;
+			totalLength += chunkLength;
+			chunkLength = 0;
+		}
+
+		chunk[chunkLength++] = ' ';
+		chunkLength += formatNumber(chunk + chunkLength, data[loopIndex]);
+		if((loopIndex + 1) < size) chunk[chunkLength++] = ',';
+	}
+	chunk[chunkLength++] = ' ';
+	chunk[chunkLength++] = '}';
+
+	if(sink(chunk, chunkLength, context) == FAIL) return FAIL;
+	totalLength += chunkLength;
+
+	return (ssize_t)totalLength;
+}
+
+/**
+ * @fn static int formatBufferSink(const char *text, size_t length, void *context)
+ * @brief 형식화된 문자열 조각을 호출자가 제공한 버퍼에 들어가는 만큼 복사하는 sink 함수
+ * @param text 형식화된 문자열 조각(입력, 읽기 전용)
+ * @param length 문자열 조각 길이(입력)
+ * @param context 버퍼 상태(입력, 출력, formatBuffer_t)
+ * @return 항상 SUCCESS 반환
+ */
+static int formatBufferSink(const char *text, size_t length, void *context)
+{
+	formatBuffer_t *buffer = (formatBuffer_t*)context;
+	size_t remain = buffer->capacity - 1 - buffer->length;
+	size_t copyLength = (length < remain) ? length : remain;
+
+	memcpy(buffer->buffer + buffer->length, text, copyLength);
+	buffer->length += copyLength;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int formatFdSink(const char *text, size_t length, void *context)
+ * @brief 형식화된 문자열 조각을 파일 디스크립터에 모두 쓰는 sink 함수
+ * @param text 형식화된 문자열 조각(입력, 읽기 전용)
+ * @param length 문자열 조각 길이(입력)
+ * @param context 파일 디스크립터(입력, int)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int formatFdSink(const char *text, size_t length, void *context)
+{
+	return writeAll(*(const int*)context, text, length);
+}
+
+/**
+ * @fn static int formatFileSink(const char *text, size_t length, void *context)
+ * @brief 형식화된 문자열 조각을 파일 스트림에 쓰는 sink 함수
+ * @param text 형식화된 문자열 조각(입력, 읽기 전용)
+ * @param length 문자열 조각 길이(입력)
+ * @param context 파일 스트림(입력, FILE)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int formatFileSink(const char *text, size_t length, void *context)
+{
+	if(fwrite(text, 1, length, (FILE*)context) != length)
+	{
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int writeAll(int fd, const void *buffer, size_t length)
+ * @brief 버퍼의 내용을 파일 디스크립터에 모두 쓰는 함수
+ * 시그널로 중단되거나 일부만 쓰여진 경우 나머지를 이어서 쓴다.
+ * @param fd 쓸 파일 디스크립터(입력)
+ * @param buffer 쓸 버퍼(입력, 읽기 전용)
+ * @param length 쓸 길이(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int writeAll(int fd, const void *buffer, size_t length)
+{
+	const char *cursor = (const char*)buffer;
+
+	while(length > 0)
+	{
+		ssize_t written = write(fd, cursor, length);
+		if(written < 0)
+		{
+			if(errno == EINTR) continue;
+			return FAIL;
+		}
+		cursor += written;
+		length -= (size_t)written;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static size_t readAll(int fd, void *buffer, size_t length)
+ * @brief 파일 디스크립터에서 지정한 길이만큼 모두 읽는 함수
+ * 시그널로 중단되거나 일부만 읽힌 경우 나머지를 이어서 읽고, 파일 끝이나 오류에서 멈춘다.
+ * @param fd 읽을 파일 디스크립터(입력)
+ * @param buffer 읽은 내용을 저장할 버퍼(출력)
+ * @param length 읽을 길이(입력)
+ * @return 항상 실제로 읽은 길이 반환 (length 보다 작으면 파일 끝 또는 오류)
+ */
+static size_t readAll(int fd, void *buffer, size_t length)
+{
+	char *cursor = (char*)buffer;
+	size_t total = 0;
+
+	while(total < length)
+	{
+		ssize_t readLength = read(fd, cursor + total, length - total);
+		if(readLength < 0)
+		{
+			if(errno == EINTR) continue;
+			break;
+		}
+		if(readLength == 0) break;
+		total += (size_t)readLength;
+	}
+
+	return total;
+}
+
+/**
+ * @fn static uint32_t updateChecksum(uint32_t checksum, const void *data, size_t length)
+ * @brief 이전 Adler-32 체크섬에 데이터를 이어서 반영한 체크섬을 계산하는 함수
+ * 나머지 연산은 누적값이 넘치기 전(ADLER32_MAX_BLOCK 바이트마다)에만 한다.
+ * @param checksum 이전 체크섬(입력, 처음에는 1)
+ * @param data 반영할 데이터(입력, 읽기 전용)
+ * @param length 데이터 길이(입력)
+ * @return 항상 갱신된 체크섬 반환
+ */
+static uint32_t updateChecksum(uint32_t checksum, const void *data, size_t length)
+{
+	const unsigned char *cursor = (const unsigned char*)data;
+	uint32_t sumA = checksum & 0xFFFFU;
+	uint32_t sumB = checksum >> 16;
+
+	while(length > 0)
+	{
+		size_t blockLength = (length < ADLER32_MAX_BLOCK) ? length : ADLER32_MAX_BLOCK;
+		length -= blockLength;
+
+		for( ; blockLength >= 4; blockLength -= 4, cursor += 4)
+		{
+			sumA += cursor[0]; sumB += sumA;
+			sumA += cursor[1]; sumB += sumA;
+			sumA += cursor[2]; sumB += sumA;
+			sumA += cursor[3]; sumB += sumA;
+		}
+		for( ; blockLength > 0; blockLength--, cursor++)
+		{
+			sumA += cursor[0]; sumB += sumA;
+		}
+
+		sumA %= ADLER32_MODULO;
+		sumB %= ADLER32_MODULO;
+	}
+
+	return (sumB << 16) | sumA;
+}
+
+/**
+ * @fn static int checkFileHeader(dynamicIntArrayFileHeader_t *header, int *isSwapped)
+ * @brief 이진 파일 헤더를 검사하고 필드들을 현재 플랫폼의 바이트 순서로 바꾸는 함수
+ * @param header 검사할 헤더(입력, 출력)
+ * @param isSwapped 파일의 바이트 순서가 현재 플랫폼과 다른지 여부(출력, YES 또는 NO)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int checkFileHeader(dynamicIntArrayFileHeader_t *header, int *isSwapped)
+{
+	if(memcmp(header->magic, DYNAMIC_INT_ARRAY_FILE_MAGIC, sizeof(header->magic)) != 0)
+	{
+		PRINT_MSG("파일 형식 오류. 파일 식별자 불일치. (checkFileHeader)", ERROR, 0);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		return FAIL;
+	}
+
+	// 헤더 체크섬은 파일에 저장된 바이트 순서 그대로 계산한다.
+	uint32_t headerChecksum = updateChecksum(1, header, offsetof(dynamicIntArrayFileHeader_t, headerChecksum));
+
+	*isSwapped = ((((header->flags & FILE_FLAG_BIG_ENDIAN) != 0) ? 1 : 0) != HOST_IS_BIG_ENDIAN) ? YES : NO;
+	if(*isSwapped == YES)
+	{
+		header->version = __builtin_bswap16(header->version);
+		header->blockSize = __builtin_bswap32(header->blockSize);
+		header->reserved = __builtin_bswap32(header->reserved);
+		header->count = __builtin_bswap64(header->count);
+		header->checksum = __builtin_bswap32(header->checksum);
+		header->headerChecksum = __builtin_bswap32(header->headerChecksum);
+	}
+
+	if(headerChecksum != header->headerChecksum)
+	{
+		PRINT_MSG("헤더 체크섬 불일치. (checkFileHeader, checksum:%u, expected:%u)", ERROR, 2, headerChecksum, header->headerChecksum);
+		dynamicIntArraySetLastError(ERROR_CHECKSUM);
+		return FAIL;
+	}
+
+	if((header->version == 0) || (header->version > DYNAMIC_INT_ARRAY_FILE_VERSION))
+	{
+		PRINT_MSG("파일 형식 오류. 지원하지 않는 버전. (checkFileHeader, version:%d)", ERROR, 1, (int)header->version);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		return FAIL;
+	}
+
+	if((header->elementWidth != sizeof(int)) || (header->blockSize == 0))
+	{
+		PRINT_MSG("파일 형식 오류. 원소 크기 또는 블록 크기 오류. (checkFileHeader, elementWidth:%d, blockSize:%u)", ERROR, 2, (int)header->elementWidth, header->blockSize);
+		dynamicIntArraySetLastError(ERROR_FORMAT);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int isSpaceCharacter(char character)
+ * @brief 문자열 파서가 무시하는 공백 문자인지 검사하는 함수
+ * @param character 검사할 문자(입력)
+ * @return 공백 문자이면 YES, 아니면 NO 반환
+ */
+static int isSpaceCharacter(char character)
+{
+	return ((character == ' ') || (character == '\t') || (character == '\n') || (character == '\r')) ? YES : NO;
+}
+
+/**
+ * @fn static int isEightDigits(const char *text)
+ * @brief 문자열의 앞 8 바이트가 모두 10 진수 숫자 문자인지 한 번에(SWAR) 검사하는 함수
+ * @param text 검사할 문자열(입력, 읽기 전용, 8 바이트 이상)
+ * @return 모두 숫자 문자이면 YES, 아니면 NO 반환
+ */
+static int isEightDigits(const char *text)
+{
+	uint64_t chunk = 0;
+	memcpy(&chunk, text, sizeof(chunk));
+
+	// 각 바이트의 상위 4 비트가 3 이고, 6 을 더해도 상위 4 비트가 넘치지 않으면('0' ~ '9') 숫자 문자이다.
+	return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL) ? YES : NO;
+}
+
+/**
+ * @fn static unsigned int parseEightDigits(const char *text)
+ * @brief 8 자리 10 진수 숫자 문자열을 곱셈 세 번으로(SWAR) 정수로 변환하는 함수
+ * 리틀 엔디안에서만 올바르게 동작한다 (PARSE_USE_SWAR 참고).
+ * @param text 변환할 문자열(입력, 읽기 전용, 8 바이트 모두 숫자 문자)
+ * @return 항상 변환한 정수 반환
+ */
+static unsigned int parseEightDigits(const char *text)
+{
+	uint64_t chunk = 0;
+	memcpy(&chunk, text, sizeof(chunk));
+
+	// 1 자리씩 8 개 -> 2 자리씩 4 개 -> 8 자리 1 개 순서로 합친다.
+	chunk -= 0x3030303030303030ULL;
+	chunk = (chunk * 10) + (chunk >> 8);
+	chunk = (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL) + (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+
+	return (unsigned int)chunk;
+}
+
+/**
+ * @fn static int parserFail(dynamicIntArrayParser_t *parser, size_t index, const char *reason)
+ * @brief 문자열 파서를 형식 오류 상태로 만들고 오류 위치를 출력하는 함수
+ * @param parser 문자열 파서 구조체 포인터(출력)
+ * @param index 현재 문자열 조각에서 오류가 발생한 위치(입력)
+ * @param reason 오류 원인(입력, 읽기 전용)
+ * @return 항상 FAIL 반환
+ */
+static int parserFail(dynamicIntArrayParser_t *parser, size_t index, const char *reason)
+{
+	parser->offset += index;
+	parser->state = PARSE_STATE_ERROR;
+
+	PRINT_MSG("문자열 형식 오류. %s. (dynamicIntArrayParserFeed, offset:%zu)", ERROR, 2, reason, parser->offset);
+	dynamicIntArraySetLastError(ERROR_FORMAT);
+
+	return FAIL;
+}
+
+/**
+ * @fn static dynamicIntArray_t *newWithCapacity(size_t size, size_t capacity, const dynamicIntArrayAllocator_t *allocator, const char *caller)
+ * @brief 동적 배열 관리 구조체를 지정한 할당자로 할당하고 지정한 크기와 용량으로 초기화하는 함수
+ * @param size 동적 배열 크기(입력)
+ * @param capacity 동적 배열 용량(입력, 크기 이상, 0 보다 커야 함)
+ * @param allocator 구조체와 동적 배열을 할당할 할당자(입력, 읽기 전용)
+ * @param caller 호출한 함수 이름(입력, 읽기 전용, 오류 출력용)
+ * @return 성공 시 동적 배열 관리 구조체의 주소, 실패 시 NULL 반환
+ */
+static dynamicIntArray_t *newWithCapacity(size_t size, size_t capacity, const dynamicIntArrayAllocator_t *allocator, const char *caller)
+{
+	dynamicIntArray_t *array = (dynamicIntArray_t*)allocator->allocate(allocator->context, sizeof(dynamicIntArray_t));
+	if(checkObjectNull(array, "메모리 생성 실패, 동적 배열 관리 구조체 포인터가 NULL. (newWithCapacity)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+		return NULL;
+	}
+
+	if(initializeWithCapacity(array, size, capacity, allocator) == FAIL)
+	{
+		PRINT_MSG("초기화 실패. initializeWithCapacity 실패. (%s)", DEBUG, 1, caller);
+		allocator->deallocate(allocator->context, array, sizeof(dynamicIntArray_t));
+		return NULL;
+	}
+
+	return array;
+}
+
+/**
+ * @fn static int initializeWithCapacity(dynamicIntArray_t *array, size_t size, size_t capacity, const dynamicIntArrayAllocator_t *allocator)
+ * @brief 동적 배열 관리 구조체의 내부(멤버 변수)를 지정한 크기와 용량으로 초기화하는 함수
+ * 용량 증가 정책은 기본값으로 설정되고, 할당된 동적 배열은 0 으로 초기화된다.
+ * 용량이 DYNAMIC_INT_ARRAY_INLINE_CAPACITY 이하면 따로 할당하지 않고 구조체의 인라인 저장소를 사용한다. (용량은 인라인 저장소 용량)
+ * @param array 동적 배열 관리 구조체 포인터(출력)
+ * @param size 동적 배열 크기(입력)
+ * @param capacity 동적 배열 용량(입력, 크기 이상, 0 보다 커야 하고 DYNAMIC_INT_ARRAY_MAX_SIZE 이하)
+ * @param allocator 동적 배열을 할당할 할당자(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int initializeWithCapacity(dynamicIntArray_t *array, size_t size, size_t capacity, const dynamicIntArrayAllocator_t *allocator)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (initializeWithCapacity)") == YES)
+	{
+		return FAIL;
+	}
+
+	if((capacity == 0) || (capacity < size) || (capacity > DYNAMIC_INT_ARRAY_MAX_SIZE))
+	{
+		PRINT_MSG("크기 또는 용량 지정 실패. (initializeWithCapacity, size:%zu, capacity:%zu)", DEBUG, 2, size, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	array->size = size;
+	array->capacity = capacity;
+	array->reservedCapacity = 0;
+	array->growthFactor = DYNAMIC_INT_ARRAY_GROWTH_FACTOR;
+	array->growthMinIncrement = DYNAMIC_INT_ARRAY_GROWTH_MIN_INCREMENT;
+	array->growthMaxSlack = DYNAMIC_INT_ARRAY_GROWTH_MAX_SLACK;
+	array->stringOfArray = NULL;
+	array->stringCapacity = 0;
+	array->storageKind = STORAGE_HEAP;
+	array->storageFd = -1;
+	array->storageBase = NULL;
+	array->storageLength = 0;
+	array->storageGeneration = 0;
+	array->adoptedFree = NULL;
+	array->cowBlock = NULL;
+	array->allocator = allocator;
+	array->data = NULL;
+
+	// 큰 배열은 익명 매핑으로 할당한다. (매핑은 0 으로 채워져 있음)
+	if(isHugeCapacity(array, capacity) == YES)
+	{
+		if(allocateHugeStorage(array, capacity) == FAIL)
+		{
+			PRINT_MSG("allocateHugeStorage 실패. (initializeWithCapacity, capacity:%zu)", DEBUG, 1, capacity);
+			array->size = 0;
+			array->capacity = 0;
+			return FAIL;
+		}
+		return SUCCESS;
+	}
+
+	if(capacity <= DYNAMIC_INT_ARRAY_INLINE_CAPACITY)
+	{
+		memset(array->inlineData, 0, sizeof(array->inlineData));
+		array->data = array->inlineData;
+		array->capacity = DYNAMIC_INT_ARRAY_INLINE_CAPACITY;
+		return SUCCESS;
+	}
+
+	array->data = (int*)allocateZeroed(allocator, capacity * sizeof(int));
+	if(checkObjectNull(array->data, "메모리 참조 실패, 동적 배열이 NULL. (initializeWithCapacity)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+		array->size = 0;
+		array->capacity = 0;
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int reallocateCapacity(dynamicIntArray_t *array, size_t capacity)
+ * @brief 동적 배열 관리 구조체가 관리하는 동적 배열을 지정한 용량으로 재할당하는 함수
+ * 기존 데이터는 유지되며, 용량이 크기보다 작아지면 크기도 용량에 맞춘다.
+ * 힙 저장소는 용량이 DYNAMIC_INT_ARRAY_INLINE_CAPACITY 이하로 줄어들면 인라인 저장소로 옮기고, 넘치면 힙에 할당해서 옮긴다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param capacity 변경할 용량(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int reallocateCapacity(dynamicIntArray_t *array, size_t capacity)
+{
+	if((capacity == 0) || (capacity > DYNAMIC_INT_ARRAY_MAX_SIZE))
+	{
+		PRINT_MSG("용량 지정 실패. 용량이 0 이거나 최대 크기 초과. (reallocateCapacity, capacity:%zu)", DEBUG, 1, capacity);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	if(capacity == array->capacity)
+	{
+		return SUCCESS;
+	}
+
+	if(array->storageKind == STORAGE_HUGE)
+	{
+		return remapHugeStorage(array, capacity);
+	}
+
+	if(array->storageKind == STORAGE_ADOPTED)
+	{
+		return detachAdoptedStorage(array, capacity);
+	}
+
+	if(array->storageKind != STORAGE_HEAP)
+	{
+		return remapCapacity(array, capacity);
+	}
+
+	// 기준 크기 이상으로 커지면 큰 배열 모드로 옮긴다. (이후 재할당은 복사 없이 mremap 으로 처리)
+	if(isHugeCapacity(array, capacity) == YES)
+	{
+		return allocateHugeStorage(array, capacity);
+	}
+
+	if(capacity <= DYNAMIC_INT_ARRAY_INLINE_CAPACITY)
+	{
+		if(isInlineStorage(array) == NO)
+		{
+			if(array->data != NULL)
+			{
+				size_t copyCount = (array->capacity < capacity) ? array->capacity : capacity;
+				memcpy(array->inlineData, array->data, copyCount * sizeof(int));
+				array->allocator->deallocate(array->allocator->context, array->data, array->capacity * sizeof(int));
+			}
+			array->data = array->inlineData;
+			array->capacity = DYNAMIC_INT_ARRAY_INLINE_CAPACITY;
+		}
+		if(array->size > capacity)
+		{
+			array->size = capacity;
+		}
+		return SUCCESS;
+	}
+
+	if(isInlineStorage(array) == YES)
+	{
+		int *heapData = (int*)array->allocator->allocate(array->allocator->context, capacity * sizeof(int));
+		if(checkObjectNull(heapData, "메모리 참조 실패, 할당한 동적 배열이 NULL. (reallocateCapacity)") == YES)
+		{
+			dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+			return FAIL;
+		}
+		memcpy(heapData, array->inlineData, DYNAMIC_INT_ARRAY_INLINE_CAPACITY * sizeof(int));
+		array->data = heapData;
+		array->capacity = capacity;
+		return SUCCESS;
+	}
+
+	int *arrayData = (int*)array->allocator->reallocate(array->allocator->context, array->data, array->capacity * sizeof(int), capacity * sizeof(int));
+	if(checkObjectNull(arrayData, "메모리 참조 실패, 재할당한 동적 배열이 NULL. (reallocateCapacity)") == YES)
+	{
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
+		return FAIL;
+	}
+
+	array->data = arrayData;
+	array->capacity = capacity;
+	if(array->size > capacity)
+	{
+		array->size = capacity;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int prepareWrite(dynamicIntArray_t *array, const char *caller)
+ * @brief 원소나 크기를 변경하기 전에 동적 배열을 변경할 수 있는지 검사하는 함수
+ * 원소를 변경하는 모든 함수는 변경하기 전에 이 함수를 호출한다.
+ * copy-on-write 복제본과 원소 저장소를 함께 사용 중이면 여기서 분리하므로, 호출한 뒤에 data 를 다시 읽어야 한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, NULL 이 아니어야 함)
+ * @param caller 호출한 함수 이름(입력, 읽기 전용, 오류 출력용)
+ * @return 변경할 수 있으면 SUCCESS, 없으면 FAIL 반환
+ */
+static int prepareWrite(dynamicIntArray_t *array, const char *caller)
+{
+	if((array->storageKind == STORAGE_MAPPED_READ_ONLY) || (array->storageKind == STORAGE_SHARED_READ_ONLY))
+	{
+		PRINT_MSG("읽기 전용 동적 배열은 변경할 수 없음. (%s)", ERROR, 1, caller);
+		dynamicIntArraySetLastError(ERROR_READ_ONLY);
+		return FAIL;
+	}
+
+	if((array->cowBlock != NULL) && (detachCowStorage(array) == FAIL))
+	{
+		PRINT_MSG("copy-on-write 저장소 분리 실패. (%s)", ERROR, 1, caller);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int narrowIndex(size_t index, const char *caller)
+ * @brief 64 비트 함수가 반환한 인덱스(또는 개수)를 int 로 반환하는 함수에 맞게 변환하는 함수
+ * @param index 변환할 인덱스(입력, DYNAMIC_INT_ARRAY_NPOS 는 찾지 못함 또는 실패)
+ * @param caller 호출한 함수 이름(입력, 읽기 전용, 오류 출력용)
+ * @return 성공 시 int 인덱스, 찾지 못했거나 실패 시 UNKNOWN, int 로 표현할 수 없으면 FAIL 반환
+ */
+static int narrowIndex(size_t index, const char *caller)
+{
+	if(index == DYNAMIC_INT_ARRAY_NPOS)
+	{
+		return UNKNOWN;
+	}
+
+	if(index > (size_t)INT_MAX)
+	{
+		PRINT_MSG("int 로 표현할 수 없는 인덱스. 64 비트 함수를 사용해야 함. (%s, index:%zu)", ERROR, 2, caller, index);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	return (int)index;
+}
+
+/**
+ * @fn static int isHugeCapacity(const dynamicIntArray_t *array, size_t capacity)
+ * @brief 힙 저장소 동적 배열을 지정한 용량으로 할당할 때 큰 배열 모드를 사용해야 하는지 검사하는 함수
+ * 큰 배열 모드는 익명 매핑을 직접 사용하므로 기본 할당자를 사용하는 동적 배열에만 적용한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용, 할당자가 지정되어 있어야 함)
+ * @param capacity 할당할 용량(입력)
+ * @return 큰 배열 모드를 사용해야 하면 YES, 아니면 NO 반환
+ */
+static int isHugeCapacity(const dynamicIntArray_t *array, size_t capacity)
+{
+	return ((array->allocator == &libcAllocator) && ((capacity * sizeof(int)) >= hugeThreshold)) ? YES : NO;
+}
+
+/**
+ * @fn static int isInlineStorage(const dynamicIntArray_t *array)
+ * @brief 동적 배열의 원소가 구조체의 인라인 저장소에 저장되어 있는지 검사하는 함수
+ * 인라인 저장소는 구조체와 함께 해제되므로 원소 메모리를 따로 해제하면 안 된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용, NULL 이 아니어야 함)
+ * @return 인라인 저장소이면 YES, 아니면 NO 반환
+ */
+static int isInlineStorage(const dynamicIntArray_t *array)
+{
+	return (array->data == array->inlineData) ? YES : NO;
+}
+
+/**
+ * @fn static int isAllocatorOwned(const dynamicIntArray_t *array)
+ * @brief 동적 배열의 원소 메모리가 동적 배열의 할당자로 할당한 메모리인지 검사하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용, NULL 이 아니어야 함)
+ * @return 할당자로 할당한 메모리이면 YES, 아니면(인라인, 매핑, 큰 배열 모드, 넘겨받은 메모리) NO 반환
+ */
+static int isAllocatorOwned(const dynamicIntArray_t *array)
+{
+	return ((array->storageKind == STORAGE_HEAP) && (array->data != NULL) && (isInlineStorage(array) == NO)) ? YES : NO;
+}
+
+/**
+ * @fn static int isAllocatorBound(const dynamicIntArray_t *array)
+ * @brief 동적 배열의 원소 저장소를 해제할 때 동적 배열의 할당자가 필요한지 검사하는 함수
+ * 넘겨받은 메모리나 큰 배열 모드 저장소라도 copy-on-write 복제본과 함께 사용 중이면 참조 횟수 블록을 할당자로 해제해야 한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용, NULL 이 아니어야 함)
+ * @return 할당자로 할당한 원소 메모리이거나 참조 횟수 블록이 연결되어 있으면 YES, 아니면 NO 반환
+ */
+static int isAllocatorBound(const dynamicIntArray_t *array)
+{
+	return ((isAllocatorOwned(array) == YES) || (array->cowBlock != NULL)) ? YES : NO;
+}
+
+/**
+ * @fn static void releaseStorage(dynamicIntArray_t *array)
+ * @brief 동적 배열의 원소 저장소를 저장소 종류에 맞게 해제하고 원소가 없는 힙 저장소로 설정하는 함수
+ * 매핑 저장소는 헤더를 갱신하거나 크기를 게시한 뒤 해제하고, 넘겨받은 메모리는 지정한 해제 함수로 해제한다.
+ * copy-on-write 복제본과 함께 사용 중이면 마지막으로 해제하는 쪽만 저장소를 해제한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력, NULL 이 아니어야 함)
+ * @return 반환값 없음
+ */
+static void releaseStorage(dynamicIntArray_t *array)
+{
+	// copy-on-write 복제본이 남아 있으면 참조만 놓고, 마지막 참조면 블록을 해제한 뒤 저장소를 해제한다.
+	if(array->cowBlock != NULL)
+	{
+		if(atomic_fetch_sub_explicit(&array->cowBlock->refCount, 1, memory_order_acq_rel) == 1)
+		{
+			array->allocator->deallocate(array->allocator->context, array->cowBlock, sizeof(dynamicIntArrayCowBlock_t));
+		}
+		else
+		{
+			array->storageKind = STORAGE_HEAP;
+			array->data = NULL;
+		}
+		array->cowBlock = NULL;
+	}
+
+	if(array->storageKind == STORAGE_ADOPTED)
+	{
+		if(array->adoptedFree != NULL)
+		{
+			array->adoptedFree(array->data);
+		}
+	}
+	else if(array->storageKind != STORAGE_HEAP)
+	{
+		// 읽기/쓰기 매핑 파일은 헤더의 원소 개수를 갱신한 뒤 해제한다. (변경 내용은 커널이 파일에 반영)
+		// 읽기/쓰기 공유 메모리는 마지막 크기를 게시한 뒤 해제한다. (공유 메모리 객체는 남아 있음)
+		if(array->storageKind == STORAGE_MAPPED_READ_WRITE)
+		{
+			updateMappedHeader(array);
+		}
+		else if(array->storageKind == STORAGE_SHARED_READ_WRITE)
+		{
+			publishSharedHeader(array);
+		}
+		munmap(array->storageBase, array->storageLength);
+		if(array->storageFd >= 0)
+		{
+			close(array->storageFd);
+		}
+	}
+	else if(isAllocatorOwned(array) == YES)
+	{
+		array->allocator->deallocate(array->allocator->context, array->data, array->capacity * sizeof(int));
+	}
+
+	array->storageKind = STORAGE_HEAP;
+	array->storageFd = -1;
+	array->storageBase = NULL;
+	array->storageLength = 0;
+	array->adoptedFree = NULL;
+	array->data = NULL;
+	array->size = 0;
+	array->capacity = 0;
+}
+
+/**
+ * @fn static void setEmptyStorage(dynamicIntArray_t *array)
+ * @brief 원소 저장소를 해제하지 않고 동적 배열을 원소가 없는 빈 힙 저장소(가능하면 인라인 저장소)로 설정하는 함수
+ * 원소 저장소를 다른 곳으로 넘긴 뒤에 호출한다.
+ * @param array 동적 배열 관리 구조체 포인터(출력, NULL 이 아니어야 함)
+ * @return 반환값 없음
+ */
+static void setEmptyStorage(dynamicIntArray_t *array)
+{
+	array->storageKind = STORAGE_HEAP;
+	array->storageFd = -1;
+	array->storageBase = NULL;
+	array->storageLength = 0;
+	array->storageGeneration = 0;
+	array->adoptedFree = NULL;
+	array->cowBlock = NULL;
+	array->size = 0;
+	array->reservedCapacity = 0;
+	if(DYNAMIC_INT_ARRAY_INLINE_CAPACITY > 0)
+	{
+		array->data = array->inlineData;
+		array->capacity = DYNAMIC_INT_ARRAY_INLINE_CAPACITY;
+	}
+	else
+	{
+		array->data = NULL;
+		array->capacity = 0;
+	}
+}
+
+/**
+ * @fn static void takeStorage(dynamicIntArray_t *dst, dynamicIntArray_t *src)
+ * @brief 원본 동적 배열의 원소 저장소를 대상 동적 배열로 옮기고 원본을 빈 동적 배열로 설정하는 함수
+ * 대상의 원소 저장소는 이미 해제되어 있어야 한다. 인라인 저장소의 원소만 대상의 인라인 저장소로 복사한다.
+ * @param dst 원소 저장소를 넘겨받을 동적 배열 관리 구조체 포인터(출력, NULL 이 아니어야 함)
+ * @param src 원소 저장소를 넘겨줄 동적 배열 관리 구조체 포인터(입력, 출력, NULL 이 아니어야 함)
+ * @return 반환값 없음
+ */
+static void takeStorage(dynamicIntArray_t *dst, dynamicIntArray_t *src)
+{
+	if(isInlineStorage(src) == YES)
+	{
+		memcpy(dst->inlineData, src->inlineData, src->size * sizeof(int));
+		dst->data = dst->inlineData;
+	}
+	else
+	{
+		dst->data = src->data;
+	}
+
+	dst->size = src->size;
+	dst->capacity = src->capacity;
+	dst->reservedCapacity = src->reservedCapacity;
+	dst->storageKind = src->storageKind;
+	dst->storageFd = src->storageFd;
+	dst->storageBase = src->storageBase;
+	dst->storageLength = src->storageLength;
+	dst->storageGeneration = src->storageGeneration;
+	dst->adoptedFree = src->adoptedFree;
+	dst->cowBlock = src->cowBlock;
+
+	setEmptyStorage(src);
+}
+
+/**
+ * @fn static int detachAdoptedStorage(dynamicIntArray_t *array, size_t capacity)
+ * @brief 넘겨받은 메모리를 사용하는 동적 배열을 할당자로 할당한 지정한 용량의 저장소로 옮기는 함수
+ * 원소를 옮긴 뒤 넘겨받은 메모리는 지정한 해제 함수로 해제한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력, 넘겨받은 메모리 저장소)
+ * @param capacity 변경할 용량(입력, 0 보다 크고 DYNAMIC_INT_ARRAY_MAX_SIZE 이하)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int detachAdoptedStorage(dynamicIntArray_t *array, size_t capacity)
+{
+	int *adoptedData = array->data;
+	size_t adoptedSize = array->size;
+	size_t adoptedCapacity = array->capacity;
+	dynamicIntArrayFree_f adoptedFree = array->adoptedFree;
+
+	// 비어 있는 힙 저장소로 바꾼 뒤 재할당하면 용량에 맞게 인라인, 힙, 큰 배열 모드 중 하나로 할당된다.
+	array->storageKind = STORAGE_HEAP;
+	array->adoptedFree = NULL;
+	array->data = NULL;
+	array->capacity = 0;
+	if(reallocateCapacity(array, capacity) == FAIL)
+	{
+		array->storageKind = STORAGE_ADOPTED;
+		array->adoptedFree = adoptedFree;
+		array->data = adoptedData;
+		array->size = adoptedSize;
+		array->capacity = adoptedCapacity;
+		return FAIL;
+	}
+
+	memcpy(array->data, adoptedData, ((adoptedCapacity < capacity) ? adoptedCapacity : capacity) * sizeof(int));
+	if(adoptedFree != NULL)
+	{
+		adoptedFree(adoptedData);
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int detachCowStorage(dynamicIntArray_t *array)
+ * @brief copy-on-write 복제본과 함께 사용 중인 원소 저장소를 이 동적 배열만 사용하도록 분리하는 함수
+ * 다른 복제본이 모두 해제되어 혼자 남았으면 참조 횟수 블록만 해제하고, 아니면 같은 용량으로 새로 할당해서 원소를 복사한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력, 참조 횟수 블록이 연결되어 있어야 함)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int detachCowStorage(dynamicIntArray_t *array)
+{
+	// 참조 횟수가 1 이면 새로 참조할 수 있는 복제본이 없으므로 다른 쓰레드와 경쟁하지 않는다.
+	if(atomic_load_explicit(&array->cowBlock->refCount, memory_order_acquire) == 1)
+	{
+		array->allocator->deallocate(array->allocator->context, array->cowBlock, sizeof(dynamicIntArrayCowBlock_t));
+		array->cowBlock = NULL;
+		return SUCCESS;
+	}
+
+	// 함께 사용하는 저장소를 임시 구조체로 옮기고 빈 저장소를 같은 용량으로 재할당해서 원소를 복사한다.
+	dynamicIntArray_t shared;
+	shared.allocator = array->allocator;
+	takeStorage(&shared, array);
+	if(reallocateCapacity(array, shared.capacity) == FAIL)
+	{
+		PRINT_MSG("reallocateCapacity 실패. (detachCowStorage, capacity:%zu)", DEBUG, 1, shared.capacity);
+		takeStorage(array, &shared);
+		return FAIL;
+	}
+
+	memcpy(array->data, shared.data, shared.size * sizeof(int));
+	array->size = shared.size;
+	array->reservedCapacity = shared.reservedCapacity;
+
+	releaseStorage(&shared);
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int initializeArrayView(const dynamicIntArray_t *array, size_t from, size_t length, int isReadOnly, dynamicIntArrayView_t *view, const char *caller)
+ * @brief 동적 배열의 지정한 구간을 가리키는 연속된 뷰를 생성하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param from 구간의 시작 인덱스(입력, 크기와 같으면 빈 뷰)
+ * @param length 구간의 원소 개수(입력)
+ * @param isReadOnly 뷰를 통한 변경 금지 여부(입력, YES 또는 NO)
+ * @param view 생성한 뷰를 저장할 뷰 구조체 포인터(출력)
+ * @param caller 오류 출력에 사용할 호출 함수 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int initializeArrayView(const dynamicIntArray_t *array, size_t from, size_t length, int isReadOnly, dynamicIntArrayView_t *view, const char *caller)
+{
+	if((checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (initializeArrayView)") == YES)
+		|| (checkObjectNull(view, "메모리 참조 실패, 뷰 구조체 포인터가 NULL. (initializeArrayView)") == YES))
+	{
+		PRINT_MSG("뷰 생성 실패. (%s)", DEBUG, 1, caller);
+		return FAIL;
+	}
+
+	if((from > array->size) || (length > (array->size - from)))
+	{
+		PRINT_MSG("뷰 생성 실패. 구간 오류. (%s, from:%zu, length:%zu, size:%zu)", ERROR, 4, caller, from, length, array->size);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	view->data = (length > 0) ? (array->data + from) : NULL;
+	view->length = length;
+	view->stride = 1;
+	view->isReadOnly = isReadOnly;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int checkView(const dynamicIntArrayView_t *view, const char *caller)
+ * @brief 뷰 구조체가 유효한지 검사하는 함수
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param caller 오류 출력에 사용할 호출 함수 이름(입력, 읽기 전용)
+ * @return 유효하면 SUCCESS, 아니면 FAIL 반환
+ */
+static int checkView(const dynamicIntArrayView_t *view, const char *caller)
+{
+	if(checkObjectNull(view, "메모리 참조 실패, 뷰 구조체 포인터가 NULL. (checkView)") == YES)
+	{
+		PRINT_MSG("뷰 검사 실패. (%s)", DEBUG, 1, caller);
+		return FAIL;
+	}
+
+	if(((view->length > 0) && (view->data == NULL)) || (view->stride == 0))
+	{
+		PRINT_MSG("잘못된 뷰. 원소 주소가 NULL 이거나 간격이 0. (%s, length:%zu, stride:%zu)", ERROR, 3, caller, view->length, view->stride);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int checkWritableView(const dynamicIntArrayView_t *view, const char *caller)
+ * @brief 뷰 구조체가 유효하고 뷰를 통해 변경할 수 있는지 검사하는 함수
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param caller 오류 출력에 사용할 호출 함수 이름(입력, 읽기 전용)
+ * @return 변경할 수 있으면 SUCCESS, 아니면 FAIL 반환
+ */
+static int checkWritableView(const dynamicIntArrayView_t *view, const char *caller)
+{
+	if(checkView(view, caller) == FAIL)
+	{
+		return FAIL;
+	}
+
+	if(view->isReadOnly != NO)
+	{
+		PRINT_MSG("읽기 전용 뷰는 변경할 수 없음. (%s)", ERROR, 1, caller);
+		dynamicIntArraySetLastError(ERROR_READ_ONLY);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int initializeWholeArrayView(const dynamicIntArray_t *array, dynamicIntArrayView_t *view, const char *caller)
+ * @brief 동적 배열 전체를 가리키는 읽기 전용 뷰를 만드는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param view 생성한 뷰를 저장할 뷰 구조체 포인터(출력)
+ * @param caller 오류 출력에 사용할 호출 함수 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int initializeWholeArrayView(const dynamicIntArray_t *array, dynamicIntArrayView_t *view, const char *caller)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (initializeWholeArrayView)") == YES)
+	{
+		PRINT_MSG("뷰 생성 실패. (%s)", DEBUG, 1, caller);
+		return FAIL;
+	}
+
+	return initializeArrayView(array, 0, array->size, YES, view, caller);
+}
+
+/**
+ * @fn static int64_t sumViewElements(const dynamicIntArrayView_t *view)
+ * @brief 검사를 마친 뷰가 가리키는 원소들의 합을 64 비트로 구하는 함수
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @return 항상 원소들의 합 반환
+ */
+static int64_t sumViewElements(const dynamicIntArrayView_t *view)
+{
+	if(view->stride == 1)
+	{
+		return simdKernels.sum(view->data, view->length);
+	}
+
+	const int *viewData = view->data;
+	int64_t sum = 0;
+	size_t loopIndex = 0;
+
+	for (; loopIndex < view->length; loopIndex++)
+	{
+		sum += viewData[loopIndex * view->stride];
+	}
+
+	return sum;
+}
+
+/**
+ * @fn static int reduceViewMinMax(const dynamicIntArrayView_t *view, int *min, int *max, const char *caller)
+ * @brief 뷰가 가리키는 원소들의 최솟값과 최댓값을 구하는 함수
+ * 연속된 뷰는 CPU 에 맞게 선택된 SIMD 최솟값/최댓값 커널을 사용한다.
+ * @param view 뷰 구조체 포인터(입력, 읽기 전용)
+ * @param min 최솟값(출력)
+ * @param max 최댓값(출력)
+ * @param caller 오류 출력에 사용할 호출 함수 이름(입력, 읽기 전용)
+ * @return 성공 시 SUCCESS, 실패 또는 빈 뷰이면 FAIL 반환
+ */
+static int reduceViewMinMax(const dynamicIntArrayView_t *view, int *min, int *max, const char *caller)
+{
+	if(checkView(view, caller) == FAIL)
+	{
+		return FAIL;
+	}
+
+	if(view->length == 0)
+	{
+		PRINT_MSG("빈 뷰의 최솟값과 최댓값은 구할 수 없음. (%s)", ERROR, 1, caller);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
+		return FAIL;
+	}
+
+	if(view->stride == 1)
+	{
+		simdKernels.minMax(view->data, view->length, min, max);
+		return SUCCESS;
+	}
+
+	const int *viewData = view->data;
+	int minValue = viewData[0];
+	int maxValue = viewData[0];
+	size_t loopIndex = 1;
+
+	for (; loopIndex < view->length; loopIndex++)
+	{
+		int value = viewData[loopIndex * view->stride];
+		minValue = (value < minValue) ? value : minValue;
+		maxValue = (value > maxValue) ? value : maxValue;
+	}
+
+	*min = minValue;
+	*max = maxValue;
+	return SUCCESS;
+}
+
+/**
+ * @fn static int checkPredicateCall(const dynamicIntArray_t *array, compareIntWithContext_f func, const char *caller)
+ * @brief 문맥을 함께 전달받는 조건 함수를 사용하는 함수들의 공통 매개변수를 검사하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param func 지정한 조건 함수(입력)
+ * @param caller 오류 출력에 사용할 호출 함수 이름(입력, 읽기 전용)
+ * @return 유효하면 SUCCESS, 아니면 FAIL 반환
+ */
+static int checkPredicateCall(const dynamicIntArray_t *array, compareIntWithContext_f func, const char *caller)
+{
+	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (checkPredicateCall)") == YES)
+	{
+		PRINT_MSG("조건 검사 실패. (%s)", DEBUG, 1, caller);
+		return FAIL;
+	}
+
+	if(func == NULL)
+	{
+		PRINT_MSG("메모리 참조 실패, 조건 함수가 NULL. (%s)", DEBUG, 1, caller);
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static size_t findIfFrom(const int *data, size_t from, size_t size, compareIntWithContext_f func, void *context)
+ * @brief 지정한 인덱스부터 문맥을 함께 전달받는 조건 함수의 조건과 일치하는 값의 첫 번째 인덱스를 검색하는 함수
+ * @param data 원소 배열(입력, 읽기 전용)
+ * @param from 검색을 시작할 인덱스(입력)
+ * @param size 원소 개수(입력)
+ * @param func 지정한 조건 함수(입력)
+ * @param context 조건 함수에 그대로 전달할 사용자 정의 데이터(입력, NULL 가능)
+ * @return 검색 성공 시 인덱스, 실패 시 DYNAMIC_INT_ARRAY_NPOS 반환
+ */
+static size_t findIfFrom(const int *data, size_t from, size_t size, compareIntWithContext_f func, void *context)
+{
+	size_t loopIndex = from;
+
+	for (; loopIndex < size; loopIndex++)
+	{
+		if (func(data[loopIndex], context) == YES)
+		{
+			return loopIndex;
+		}
+	}
+
+	return DYNAMIC_INT_ARRAY_NPOS;
+}
+
+/**
+ * @fn static int compilePredicateNode(const dynamicIntArrayPredicate_t *node, dynamicIntArrayPredicateProgram_t *program, size_t depth)
+ * @brief 조건 서술자 트리의 노드 하나를 후위 표기법 단계로 컴파일하는 함수
+ * 하위 조건들을 먼저 컴파일한 뒤 결합 단계를 추가한다.
+ * @param node 컴파일할 노드(입력, 읽기 전용)
+ * @param program 단계를 추가할 컴파일한 조건 구조체 포인터(입력, 출력)
+ * @param depth 트리 깊이(입력, 순환 참조 검사용)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int compilePredicateNode(const dynamicIntArrayPredicate_t *node, dynamicIntArrayPredicateProgram_t *program, size_t depth)
+{
+	if(checkObjectNull(node, "메모리 참조 실패, 조건 서술자 노드가 NULL. (compilePredicateNode)") == YES)
+	{
+		return FAIL;
+	}
+
+	// 노드마다 단계가 하나 이상 추가되므로 최대 단계 수보다 깊은 트리는 단계 수를 넘거나 순환한다.
+	if(depth >= DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS)
+	{
+		PRINT_MSG("조건 서술자 트리가 너무 깊음. (compilePredicateNode, depth:%zu)", ERROR, 1, depth);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	int result = SUCCESS;
+	switch(node->op)
+	{
+		case PREDICATE_OP_EQUAL:
+			result = addPredicateStep(program, SIMD_PREDICATE_EQUAL, node->operand1, 0);
+			break;
+		case PREDICATE_OP_NOT_EQUAL:
+			result = addPredicateStep(program, SIMD_PREDICATE_EQUAL, node->operand1, 0);
+			result = (result == SUCCESS) ? addPredicateStep(program, SIMD_PREDICATE_NOT, 0, 0) : FAIL;
+			break;
+		case PREDICATE_OP_LESS:
+			result = addPredicateStep(program, SIMD_PREDICATE_LESS, node->operand1, 0);
+			break;
+		case PREDICATE_OP_LESS_EQUAL:
+			result = (node->operand1 == INT_MAX) ? addPredicateStep(program, SIMD_PREDICATE_CONSTANT, YES, 0)
+				: addPredicateStep(program, SIMD_PREDICATE_LESS, node->operand1 + 1, 0);
+			break;
+		case PREDICATE_OP_GREATER:
+			result = addPredicateStep(program, SIMD_PREDICATE_GREATER, node->operand1, 0);
+			break;
+		case PREDICATE_OP_GREATER_EQUAL:
+			result = (node->operand1 == INT_MIN) ? addPredicateStep(program, SIMD_PREDICATE_CONSTANT, YES, 0)
+				: addPredicateStep(program, SIMD_PREDICATE_GREATER, node->operand1 - 1, 0);
+			break;
+		case PREDICATE_OP_RANGE:
+			// 구간 검사는 [value - 하한] 을 부호 없는 정수로 보고 구간 폭과 한 번만 비교한다.
+			result = (node->operand1 > node->operand2) ? addPredicateStep(program, SIMD_PREDICATE_CONSTANT, NO, 0)
+				: addPredicateStep(program, SIMD_PREDICATE_RANGE, node->operand1, (int)((unsigned int)node->operand2 - (unsigned int)node->operand1));
+			break;
+		case PREDICATE_OP_BITS_EQUAL:
+			result = addPredicateStep(program, SIMD_PREDICATE_BITS_EQUAL, node->operand1, node->operand2);
+			break;
+		case PREDICATE_OP_EVEN:
+			result = addPredicateStep(program, SIMD_PREDICATE_BITS_EQUAL, 1, 0);
+			break;
+		case PREDICATE_OP_ODD:
+			result = addPredicateStep(program, SIMD_PREDICATE_BITS_EQUAL, 1, 1);
+			break;
+		case PREDICATE_OP_AND:
+		case PREDICATE_OP_OR:
+			if((compilePredicateNode(node->left, program, depth + 1) == FAIL)
+				|| (compilePredicateNode(node->right, program, depth + 1) == FAIL))
+			{
+				return FAIL;
+			}
+			result = addPredicateStep(program, (node->op == PREDICATE_OP_AND) ? SIMD_PREDICATE_AND : SIMD_PREDICATE_OR, 0, 0);
+			break;
+		case PREDICATE_OP_NOT:
+			if(compilePredicateNode(node->left, program, depth + 1) == FAIL)
+			{
+				return FAIL;
+			}
+			result = addPredicateStep(program, SIMD_PREDICATE_NOT, 0, 0);
+			break;
+		default:
+			PRINT_MSG("알 수 없는 조건 서술자 연산. (compilePredicateNode, op:%d)", ERROR, 1, node->op);
+			dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+			return FAIL;
+	}
+
+	return result;
+}
+
+/**
+ * @fn static int addPredicateStep(dynamicIntArrayPredicateProgram_t *program, int kind, int operand1, int operand2)
+ * @brief 컴파일한 조건의 끝에 단계 하나를 추가하는 함수
+ * @param program 컴파일한 조건 구조체 포인터(입력, 출력)
+ * @param kind 단계 종류(입력, SIMD_PREDICATE_STEP 열거형 참고)
+ * @param operand1 첫 번째 피연산자(입력)
+ * @param operand2 두 번째 피연산자(입력)
+ * @return 성공 시 SUCCESS, 최대 단계 수를 넘으면 FAIL 반환
+ */
+static int addPredicateStep(dynamicIntArrayPredicateProgram_t *program, int kind, int operand1, int operand2)
+{
+	if(program->stepCount >= DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS)
+	{
+		PRINT_MSG("조건 서술자 단계 수 초과. (addPredicateStep, max:%d)", ERROR, 1, DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	dynamicIntArrayPredicateStep_t *step = &program->steps[program->stepCount++];
+	step->kind = kind;
+	step->operand1 = operand1;
+	step->operand2 = operand2;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int checkPredicateProgram(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program, const char *caller)
+ * @brief 컴파일한 조건을 사용하는 함수들의 공통 매개변수를 검사하는 함수
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param program 컴파일한 조건(입력, 읽기 전용)
+ * @param caller 오류 출력에 사용할 호출 함수 이름(입력, 읽기 전용)
+ * @return 유효하면 SUCCESS, 아니면 FAIL 반환
+ */
+static int checkPredicateProgram(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program, const char *caller)
+{
+	if((checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (checkPredicateProgram)") == YES)
+		|| (checkObjectNull(program, "메모리 참조 실패, 컴파일한 조건 구조체 포인터가 NULL. (checkPredicateProgram)") == YES))
+	{
+		PRINT_MSG("조건 검사 실패. (%s)", DEBUG, 1, caller);
+		return FAIL;
+	}
+
+	if((program->stepCount == 0) || (program->stepCount > DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS))
+	{
+		PRINT_MSG("컴파일되지 않은 조건. dynamicIntArrayPredicateCompile 을 먼저 호출해야 함. (%s, stepCount:%zu)", ERROR, 2, caller, program->stepCount);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	// 직접 만든 조건도 커널의 마스크 스택이 넘치거나 모자라지 않도록 단계 종류와 스택 깊이를 검사한다.
+	// (비교 단계는 마스크를 하나 쌓고, NOT 은 하나, AND/OR 는 두 개를 꺼내서 하나를 쌓으며, 끝나면 하나만 남아야 함)
+	size_t depth = 0;
+	size_t stepIndex = 0;
+	for(; stepIndex < program->stepCount; stepIndex++)
+	{
+		int kind = program->steps[stepIndex].kind;
+		size_t required = 0;
+		if((kind == SIMD_PREDICATE_AND) || (kind == SIMD_PREDICATE_OR))
+		{
+			required = 2;
+		}
+		else if(kind == SIMD_PREDICATE_NOT)
+		{
+			required = 1;
+		}
+		else if((kind < SIMD_PREDICATE_CONSTANT) || (kind > SIMD_PREDICATE_BITS_EQUAL))
+		{
+			PRINT_MSG("잘못된 조건. 알 수 없는 단계 종류. (%s, stepIndex:%zu, kind:%d)", ERROR, 3, caller, stepIndex, kind);
+			dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+			return FAIL;
+		}
+
+		if(depth < required)
+		{
+			PRINT_MSG("잘못된 조건. 결합할 마스크가 부족함. (%s, stepIndex:%zu, depth:%zu)", ERROR, 3, caller, stepIndex, depth);
+			dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+			return FAIL;
+		}
+
+		depth = (required == 0) ? (depth + 1) : (depth - required + 1);
+	}
+
+	if(depth != 1)
+	{
+		PRINT_MSG("잘못된 조건. 평가 후 남는 마스크가 하나가 아님. (%s, depth:%zu)", ERROR, 2, caller, depth);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static void *allocateZeroed(const dynamicIntArrayAllocator_t *allocator, size_t size)
+ * @brief 지정한 할당자로 메모리를 할당하고 0 으로 초기화하는 함수
+ * 기본 할당자는 재사용 캐시의 크기 등급보다 큰 메모리를 이미 0 으로 채워진 페이지를 다시 채우지 않도록 calloc 으로 할당한다.
+ * @param allocator 사용할 할당자(입력, 읽기 전용)
+ * @param size 할당할 크기(입력, 바이트)
+ * @return 성공 시 할당한 메모리, 실패 시 NULL 반환
+ */
+static void *allocateZeroed(const dynamicIntArrayAllocator_t *allocator, size_t size)
 {
-	if(dynamicIntArrayCheckBoundary(array, index) == FAIL)
+	if((allocator == &libcAllocator) && (getRecycleClass(size) == UNKNOWN))
 	{
-		printMsg("Remove at 실패. 인덱스 오류. (dynamicIntArrayRemoveAt)", ERROR, 0);
-		return NULL;
+		return calloc(size, 1);
 	}
 
-	int size = array->size;
-	int positionOfCopy = index + 1;
-	int tempArraySize = size - positionOfCopy;
-	dynamicIntArray_t tempArray;
+	void *pointer = allocator->allocate(allocator->context, size);
+	if(pointer != NULL)
+	{
+		memset(pointer, 0, size);
+	}
+
+	return pointer;
+}
 
-	if(dynamicIntArrayInitialize(&tempArray, tempArraySize) == FAIL)
+/**
+ * @fn static int checkAllocator(const dynamicIntArrayAllocator_t *allocator, const char *caller)
+ * @brief 할당자와 할당자의 함수들이 모두 지정되어 있는지 검사하는 함수
+ * @param allocator 검사할 할당자(입력, 읽기 전용)
+ * @param caller 호출한 함수 이름(입력, 읽기 전용, 오류 출력용)
+ * @return 사용할 수 있으면 SUCCESS, 없으면 FAIL 반환
+ */
+static int checkAllocator(const dynamicIntArrayAllocator_t *allocator, const char *caller)
+{
+	if((allocator == NULL) || (allocator->allocate == NULL) || (allocator->reallocate == NULL) || (allocator->deallocate == NULL))
 	{
-		printMsg("동적 배열 관리 구조체 초기화 실패. (dynamicIntArrayRemoveAt)", DEBUG, 0);
-		return NULL;
+		PRINT_MSG("메모리 참조 실패, 할당자 또는 할당자 함수가 NULL. (%s)", ERROR, 1, caller);
+		dynamicIntArraySetLastError(ERROR_NULL_REFERENCE);
+		return FAIL;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static void *libcAllocate(void *context, size_t size)
+ * @brief 기본 할당자의 할당 함수
+ * 재사용 캐시의 크기 등급이면 쓰레드별 재사용 캐시에서 먼저 꺼내고, 비어 있으면 크기 등급 크기로 malloc 한다.
+ * @param context 사용하지 않음
+ * @param size 할당할 크기(입력, 바이트)
+ * @return 성공 시 할당한 메모리, 실패 시 NULL 반환
+ */
+static void *libcAllocate(void *context, size_t size)
+{
+	(void)context;
+	int sizeClass = getRecycleClass(size);
+	if(sizeClass == UNKNOWN)
+	{
+		return malloc(size);
+	}
+
+	recycleCache_t *cache = &recycleThreadCache;
+	void *pointer = cache->freeLists[sizeClass];
+	if(pointer != NULL)
+	{
+		cache->freeLists[sizeClass] = *(void**)pointer;
+		cache->counts[sizeClass]--;
+		cache->hits++;
+		return pointer;
+	}
+
+	cache->misses++;
+	return malloc(getRecycleClassSize(sizeClass));
+}
+
+/**
+ * @fn static void *libcReallocate(void *context, void *pointer, size_t oldSize, size_t newSize)
+ * @brief 기본 할당자의 재할당 함수
+ * 크기 등급이 바뀌지 않으면 그대로 사용하고, 두 크기 모두 재사용 캐시의 크기 등급보다 크면 realloc 을 사용한다.
+ * 그 밖에는 새로 할당해서 복사한 뒤 기존 메모리를 해제(재사용 캐시에 보관)한다.
+ * @param context 사용하지 않음
+ * @param pointer 재할당할 메모리(입력, NULL 이면 새로 할당)
+ * @param oldSize 기존 크기(입력, 바이트)
+ * @param newSize 재할당할 크기(입력, 바이트)
+ * @return 성공 시 재할당한 메모리, 실패 시 NULL 반환
+ */
+static void *libcReallocate(void *context, void *pointer, size_t oldSize, size_t newSize)
+{
+	if(pointer == NULL)
+	{
+		return libcAllocate(context, newSize);
+	}
+
+	int oldClass = getRecycleClass(oldSize);
+	int newClass = getRecycleClass(newSize);
+	if((oldClass == UNKNOWN) && (newClass == UNKNOWN))
+	{
+		return realloc(pointer, newSize);
 	}
 
-	if (dynamicIntArrayCopy(&tempArray, 0, array, positionOfCopy, tempArraySize) == FAIL)
+	if(oldClass == newClass)
+	{
+		return pointer;
+	}
+
+	void *newPointer = libcAllocate(context, newSize);
+	if(newPointer == NULL)
 	{
-		printMsg("배열 복사 오류. dynamicIntArrayCopy 동작 실패. (dynamicIntArrayRemoveAt, tempArray -> array)", DEBUG, 0);
 		return NULL;
 	}
+	memcpy(newPointer, pointer, (oldSize < newSize) ? oldSize : newSize);
+	libcDeallocate(context, pointer, oldSize);
+
+	return newPointer;
+}
+
+/**
+ * @fn static void libcDeallocate(void *context, void *pointer, size_t size)
+ * @brief 기본 할당자의 해제 함수
+ * 재사용 캐시의 크기 등급이면 보관 개수 제한까지 쓰레드별 재사용 캐시에 보관하고, 나머지는 free 로 해제한다.
+ * @param context 사용하지 않음
+ * @param pointer 해제할 메모리(입력)
+ * @param size 할당한 크기(입력, 바이트)
+ * @return 반환값 없음
+ */
+static void libcDeallocate(void *context, void *pointer, size_t size)
+{
+	(void)context;
+	if(pointer == NULL)
+	{
+		return;
+	}
+
+	int sizeClass = getRecycleClass(size);
+	if(sizeClass != UNKNOWN)
+	{
+		recycleCache_t *cache = &recycleThreadCache;
+		if((cache->counts[sizeClass] < recycleLimit) && (registerRecycleCache(cache) == SUCCESS))
+		{
+			*(void**)pointer = cache->freeLists[sizeClass];
+			cache->freeLists[sizeClass] = pointer;
+			cache->counts[sizeClass]++;
+			cache->recycled++;
+			return;
+		}
+		cache->released++;
+	}
+
+	free(pointer);
+}
+
+/**
+ * @fn static int getRecycleClass(size_t size)
+ * @brief 기본 할당자에서 지정한 크기를 재사용 캐시의 어느 목록에 보관하는지 반환하는 함수
+ * 관리 구조체 크기는 따로 보관하고, 나머지는 풀 할당자와 같은 2 의 거듭제곱 크기 등급을 사용한다.
+ * @param size 할당할 크기(입력, 바이트)
+ * @return 크기 등급 (0 ~ DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT - 1 또는 RECYCLE_HEADER_CLASS), 재사용하지 않는 크기면 UNKNOWN 반환
+ */
+static int getRecycleClass(size_t size)
+{
+	if(size == sizeof(dynamicIntArray_t))
+	{
+		return RECYCLE_HEADER_CLASS;
+	}
+
+	int sizeClass = getPoolClass(size);
+
+	return ((sizeClass != UNKNOWN) && (sizeClass < DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT)) ? sizeClass : UNKNOWN;
+}
+
+/**
+ * @fn static size_t getRecycleClassSize(int sizeClass)
+ * @brief 재사용 캐시의 크기 등급에 보관하는 메모리의 실제 할당 크기를 반환하는 함수
+ * @param sizeClass 크기 등급(입력, getRecycleClass 반환값)
+ * @return 할당 크기 반환 (바이트)
+ */
+static size_t getRecycleClassSize(int sizeClass)
+{
+	if(sizeClass == RECYCLE_HEADER_CLASS)
+	{
+		return sizeof(dynamicIntArray_t);
+	}
+
+	return DYNAMIC_INT_ARRAY_POOL_MIN_CLASS_SIZE << sizeClass;
+}
+
+/**
+ * @fn static int registerRecycleCache(recycleCache_t *cache)
+ * @brief 쓰레드가 끝날 때 재사용 캐시가 해제되도록 쓰레드 키에 등록하는 함수
+ * 쓰레드 키를 만들지 못하면 캐시에 보관하지 않고 바로 해제하도록 FAIL 을 반환한다.
+ * @param cache 호출한 쓰레드의 재사용 캐시(입력, 출력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int registerRecycleCache(recycleCache_t *cache)
+{
+	if(cache->isRegistered == YES)
+	{
+		return SUCCESS;
+	}
+
+	if((pthread_once(&recycleKeyOnce, createRecycleKey) != 0) || (isRecycleKeyCreated == NO))
+	{
+		return FAIL;
+	}
+
+	if(pthread_setspecific(recycleKey, cache) != 0)
+	{
+		return FAIL;
+	}
+
+	cache->isRegistered = YES;
+	return SUCCESS;
+}
+
+/**
+ * @fn static void createRecycleKey(void)
+ * @brief 재사용 캐시를 해제하는 쓰레드 키를 한 번 생성하는 함수 (pthread_once 에서 호출)
+ * @return 반환값 없음
+ */
+static void createRecycleKey(void)
+{
+	if(pthread_key_create(&recycleKey, releaseRecycleCache) == 0)
+	{
+		isRecycleKeyCreated = YES;
+	}
+}
+
+/**
+ * @fn static void releaseRecycleCache(void *context)
+ * @brief 쓰레드가 끝날 때 그 쓰레드의 재사용 캐시를 해제하는 함수 (쓰레드 키 소멸자)
+ * 이후에 다시 보관하면 다시 등록해서 해제되도록 등록 여부를 지운다.
+ * @param context 끝나는 쓰레드의 재사용 캐시(입력, 출력, recycleCache_t)
+ * @return 반환값 없음
+ */
+static void releaseRecycleCache(void *context)
+{
+	recycleCache_t *cache = (recycleCache_t*)context;
+	trimRecycleCache(cache);
+	cache->isRegistered = NO;
+}
+
+/**
+ * @fn static size_t trimRecycleCache(recycleCache_t *cache)
+ * @brief 재사용 캐시에 보관 중인 메모리를 모두 해제하는 함수
+ * @param cache 비울 재사용 캐시(입력, 출력)
+ * @return 해제한 전체 크기 반환 (바이트)
+ */
+static size_t trimRecycleCache(recycleCache_t *cache)
+{
+	size_t trimmedBytes = 0;
+	int sizeClass = 0;
+	for( ; sizeClass <= RECYCLE_HEADER_CLASS; sizeClass++)
+	{
+		void *pointer = cache->freeLists[sizeClass];
+		while(pointer != NULL)
+		{
+			void *next = *(void**)pointer;
+			free(pointer);
+			pointer = next;
+		}
+		trimmedBytes += cache->counts[sizeClass] * getRecycleClassSize(sizeClass);
+		cache->freeLists[sizeClass] = NULL;
+		cache->counts[sizeClass] = 0;
+	}
+
+	return trimmedBytes;
+}
 
-	array = dynamicIntArrayResize(array, --(array->size), YES);
-	if(checkObjectNull(array, "메모리 재생성 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayRemoveAt)") == YES)
+/**
+ * @fn static void *arenaAllocate(void *context, size_t size)
+ * @brief 아레나 할당자의 할당 함수
+ * 현재 블록에 남은 공간이 있으면 포인터만 증가시키고, 없으면 새 블록을 할당한다.
+ * 기본 블록 크기보다 큰 요청은 전용 블록을 현재 블록 뒤에 연결해서 현재 블록의 남은 공간을 계속 사용한다.
+ * @param context 아레나 할당자 구조체(입력, 출력, dynamicIntArrayArena_t)
+ * @param size 할당할 크기(입력, 바이트)
+ * @return 성공 시 할당한 메모리, 실패 시 NULL 반환
+ */
+static void *arenaAllocate(void *context, size_t size)
+{
+	dynamicIntArrayArena_t *arena = (dynamicIntArrayArena_t*)context;
+	if(size > (SIZE_MAX / 2))
 	{
-		++(array->size);
 		return NULL;
 	}
 
-	if (dynamicIntArrayCopy(array, index, &tempArray, 0, tempArraySize) == FAIL)
+	size_t alignedSize = ALLOCATOR_ALIGN_UP((size > 0) ? size : 1);
+	size_t headerSize = ALLOCATOR_ALIGN_UP(sizeof(dynamicIntArrayArenaBlock_t));
+	dynamicIntArrayArenaBlock_t *block = arena->blocks;
+	if((block != NULL) && ((block->size - block->used) >= alignedSize))
+	{
+		void *pointer = (char*)block + headerSize + block->used;
+		block->used += alignedSize;
+		return pointer;
+	}
+
+	size_t blockSize = (alignedSize > arena->blockSize) ? alignedSize : arena->blockSize;
+	dynamicIntArrayArenaBlock_t *newBlock = (dynamicIntArrayArenaBlock_t*)malloc(headerSize + blockSize);
+	if(newBlock == NULL)
 	{
-		printMsg("배열 복사 오류. dynamicIntArrayCopy 동작 실패. (dynamicIntArrayRemoveAt, array -> tempArray)", DEBUG, 0);
 		return NULL;
 	}
+	newBlock->size = blockSize;
+	newBlock->used = alignedSize;
+
+	if((block != NULL) && (alignedSize > arena->blockSize))
+	{
+		newBlock->next = block->next;
+		block->next = newBlock;
+	}
+	else
+	{
+		newBlock->next = block;
+		arena->blocks = newBlock;
+	}
+
+	return (char*)newBlock + headerSize;
+}
 
+/**
+ * @fn static void *arenaReallocate(void *context, void *pointer, size_t oldSize, size_t newSize)
+ * @brief 아레나 할당자의 재할당 함수
+ * 현재 블록의 마지막 할당이면 제자리에서 늘리거나 줄이고, 아니면 새로 할당해서 복사한다. (이전 공간은 Reset 때 해제)
+ * @param context 아레나 할당자 구조체(입력, 출력, dynamicIntArrayArena_t)
+ * @param pointer 재할당할 메모리(입력, NULL 이면 새로 할당)
+ * @param oldSize 기존 크기(입력, 바이트)
+ * @param newSize 재할당할 크기(입력, 바이트)
+ * @return 성공 시 재할당한 메모리, 실패 시 NULL 반환
+ */
+static void *arenaReallocate(void *context, void *pointer, size_t oldSize, size_t newSize)
+{
+	dynamicIntArrayArena_t *arena = (dynamicIntArrayArena_t*)context;
+	if(pointer == NULL)
+	{
+		return arenaAllocate(context, newSize);
+	}
 
-	if(dynamicIntArrayFinal(&tempArray) == FAIL)
+	if(newSize > (SIZE_MAX / 2))
 	{
-		printMsg("tempArray 내부 동적 배열 메모리 해제 실패. dynamicIntArrayFinal 실패. (dynamicIntArrayRemoveAt)", DEBUG, 0);
 		return NULL;
 	}
 
-	return array;
+	size_t oldAlignedSize = ALLOCATOR_ALIGN_UP((oldSize > 0) ? oldSize : 1);
+	size_t newAlignedSize = ALLOCATOR_ALIGN_UP((newSize > 0) ? newSize : 1);
+	dynamicIntArrayArenaBlock_t *block = arena->blocks;
+	if(block != NULL)
+	{
+		char *blockData = (char*)block + ALLOCATOR_ALIGN_UP(sizeof(dynamicIntArrayArenaBlock_t));
+		if(((char*)pointer + oldAlignedSize) == (blockData + block->used))
+		{
+			size_t offset = block->used - oldAlignedSize;
+			if((block->size - offset) >= newAlignedSize)
+			{
+				block->used = offset + newAlignedSize;
+				return pointer;
+			}
+		}
+	}
+
+	if(newAlignedSize <= oldAlignedSize)
+	{
+		return pointer;
+	}
+
+	void *newPointer = arenaAllocate(context, newSize);
+	if(newPointer != NULL)
+	{
+		memcpy(newPointer, pointer, oldSize);
+	}
+
+	return newPointer;
 }
 
 /**
- * @fn int dynamicIntArrayIndexOf(const dynamicIntArray_t *array, int datum)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 첫 번째 인덱스를 반환하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param datum 지정한 값(입력)
- * @return 성공 시 검색된 인덱스, 검색 실패 시 UNKNOWN, 내부 함수 호출 실패 시 FAIL 반환
+ * @fn static void arenaDeallocate(void *context, void *pointer, size_t size)
+ * @brief 아레나 할당자의 해제 함수
+ * 현재 블록의 마지막 할당만 되돌리고, 나머지는 dynamicIntArrayArenaReset 에서 한 번에 해제한다.
+ * @param context 아레나 할당자 구조체(입력, 출력, dynamicIntArrayArena_t)
+ * @param pointer 해제할 메모리(입력)
+ * @param size 할당한 크기(입력, 바이트)
+ * @return 반환값 없음
  */
-int dynamicIntArrayIndexOf(const dynamicIntArray_t *array, int datum)
+static void arenaDeallocate(void *context, void *pointer, size_t size)
 {
-	int size = dynamicIntArrayGetSize(array);
-	if(size == UNKNOWN)
+	dynamicIntArrayArena_t *arena = (dynamicIntArrayArena_t*)context;
+	dynamicIntArrayArenaBlock_t *block = arena->blocks;
+	if((pointer == NULL) || (block == NULL))
 	{
-		printMsg("dynamicIntArrayGetSize 실패. (dynamicIntArrayIndexOf, array:%p)", DEBUG, 1, array);
-		return FAIL;
+		return;
 	}
 
-	int targetIndex = UNKNOWN;
-	int value = UNKNOWN;
-	int loopIndex = 0;
-	int isError = FAIL;
+	size_t alignedSize = ALLOCATOR_ALIGN_UP((size > 0) ? size : 1);
+	char *blockData = (char*)block + ALLOCATOR_ALIGN_UP(sizeof(dynamicIntArrayArenaBlock_t));
+	if(((char*)pointer + alignedSize) == (blockData + block->used))
+	{
+		block->used -= alignedSize;
+	}
+}
 
-	for (; loopIndex < size; loopIndex++)
+/**
+ * @fn static int getPoolClass(size_t size)
+ * @brief 풀 할당자에서 지정한 크기를 담을 수 있는 가장 작은 크기 등급을 반환하는 함수
+ * @param size 할당할 크기(입력, 바이트)
+ * @return 크기 등급 (0 ~ DYNAMIC_INT_ARRAY_POOL_CLASS_COUNT - 1), 가장 큰 크기 등급보다 크면 UNKNOWN 반환
+ */
+static int getPoolClass(size_t size)
+{
+	if(size <= DYNAMIC_INT_ARRAY_POOL_MIN_CLASS_SIZE)
+	{
+		return 0;
+	}
+
+	// [크기 등급] = ceil(log2(size)) - log2(최소 크기 등급)
+	int sizeClass = (int)(sizeof(unsigned long long) * CHAR_BIT) - __builtin_clzll((unsigned long long)(size - 1)) - POOL_MIN_CLASS_SHIFT;
+
+	return (sizeClass < DYNAMIC_INT_ARRAY_POOL_CLASS_COUNT) ? sizeClass : UNKNOWN;
+}
+
+/**
+ * @fn static void *poolAllocate(void *context, size_t size)
+ * @brief 풀 할당자의 할당 함수
+ * 크기 등급의 free list 에 조각이 있으면 재사용하고, 없으면 slab 에서 잘라 쓴다.
+ * 가장 큰 크기 등급보다 큰 요청은 따로 할당해서 큰 메모리 목록에 연결한다.
+ * @param context 풀 할당자 구조체(입력, 출력, dynamicIntArrayPool_t)
+ * @param size 할당할 크기(입력, 바이트)
+ * @return 성공 시 할당한 메모리, 실패 시 NULL 반환
+ */
+static void *poolAllocate(void *context, size_t size)
+{
+	dynamicIntArrayPool_t *pool = (dynamicIntArrayPool_t*)context;
+	int sizeClass = getPoolClass(size);
+	if(sizeClass == UNKNOWN)
 	{
-		value = dynamicIntArrayGetElement(array, loopIndex, &isError);
-		if(isError == FAIL) 
+		size_t headerSize = ALLOCATOR_ALIGN_UP(sizeof(dynamicIntArrayPoolLarge_t));
+		if(size > (SIZE_MAX - headerSize))
 		{
-			printMsg("동적 배열 원소 조회 실패. dynamicIntArrayGetElement 실패. (dynamicIntArrayIndexOf)", ERROR, 0);
-			return FAIL;
+			return NULL;
 		}
 
-		if (value == datum)
+		dynamicIntArrayPoolLarge_t *large = (dynamicIntArrayPoolLarge_t*)malloc(headerSize + size);
+		if(large == NULL)
 		{
-			targetIndex = loopIndex;
-			break;
+			return NULL;
+		}
+		large->prev = NULL;
+		large->next = pool->larges;
+		if(pool->larges != NULL)
+		{
+			pool->larges->prev = large;
 		}
+		pool->larges = large;
+
+		return (char*)large + headerSize;
+	}
+
+	void *pointer = pool->freeLists[sizeClass];
+	if(pointer != NULL)
+	{
+		pool->freeLists[sizeClass] = *(void**)pointer;
+		return pointer;
+	}
+
+	size_t classSize = DYNAMIC_INT_ARRAY_POOL_MIN_CLASS_SIZE << sizeClass;
+	size_t headerSize = ALLOCATOR_ALIGN_UP(sizeof(dynamicIntArrayPoolSlab_t));
+	dynamicIntArrayPoolSlab_t *slab = pool->slabs;
+	if((slab == NULL) || ((DYNAMIC_INT_ARRAY_POOL_SLAB_SIZE - headerSize - slab->used) < classSize))
+	{
+		slab = (dynamicIntArrayPoolSlab_t*)malloc(DYNAMIC_INT_ARRAY_POOL_SLAB_SIZE);
+		if(slab == NULL)
+		{
+			return NULL;
+		}
+		slab->next = pool->slabs;
+		slab->used = 0;
+		pool->slabs = slab;
 	}
 
-	return targetIndex;
+	pointer = (char*)slab + headerSize + slab->used;
+	slab->used += classSize;
+
+	return pointer;
 }
 
 /**
- * @fn int dynamicIntArrayLastIndexOf(const dynamicIntArray_t *array, int datum)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 값의 마지막 인덱스를 반환하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param datum 지정한 값(입력)
- * @return 성공 시 검색된 인덱스, 검색 실패 시 UNKNOWN, 내부 함수 호출 실패 시 FAIL 반환
+ * @fn static void *poolReallocate(void *context, void *pointer, size_t oldSize, size_t newSize)
+ * @brief 풀 할당자의 재할당 함수
+ * 크기 등급이 바뀌지 않으면 그대로 사용하고, 바뀌면 새 등급에서 할당해서 복사한 뒤 기존 조각을 free list 에 돌려준다.
+ * @param context 풀 할당자 구조체(입력, 출력, dynamicIntArrayPool_t)
+ * @param pointer 재할당할 메모리(입력, NULL 이면 새로 할당)
+ * @param oldSize 기존 크기(입력, 바이트)
+ * @param newSize 재할당할 크기(입력, 바이트)
+ * @return 성공 시 재할당한 메모리, 실패 시 NULL 반환
  */
-int dynamicIntArrayLastIndexOf(const dynamicIntArray_t *array, int datum)
+static void *poolReallocate(void *context, void *pointer, size_t oldSize, size_t newSize)
 {
-	int size = dynamicIntArrayGetSize(array);
-	if(size == UNKNOWN)
+	dynamicIntArrayPool_t *pool = (dynamicIntArrayPool_t*)context;
+	if(pointer == NULL)
 	{
-		printMsg("dynamicIntArrayGetSize 실패. (dynamicIntArrayLastIndexOf, array:%p)", DEBUG, 1, array);
-		return FAIL;
+		return poolAllocate(context, newSize);
 	}
 
-	int targetIndex = UNKNOWN;
-	int value = UNKNOWN;
-	int loopIndex = size - 1;
-	int isError = FAIL;
+	int oldClass = getPoolClass(oldSize);
+	int newClass = getPoolClass(newSize);
+	if((oldClass == newClass) && (oldClass != UNKNOWN))
+	{
+		return pointer;
+	}
 
-	for (; loopIndex >= 0; loopIndex--)
+	// 큰 메모리끼리는 realloc 으로 옮긴 뒤 목록의 연결만 고친다.
+	if((oldClass == UNKNOWN) && (newClass == UNKNOWN))
 	{
-		value = dynamicIntArrayGetElement(array, loopIndex, &isError);
-		if(isError == FAIL)
+		size_t headerSize = ALLOCATOR_ALIGN_UP(sizeof(dynamicIntArrayPoolLarge_t));
+		if(newSize > (SIZE_MAX - headerSize))
 		{
-			printMsg("동적 배열 원소 조회 실패. dynamicIntArrayGetElement 실패. (dynamicIntArrayLastIndexOf)", ERROR, 0);
-			return FAIL;
+			return NULL;
 		}
 
-		if (value == datum)
+		dynamicIntArrayPoolLarge_t *large = (dynamicIntArrayPoolLarge_t*)realloc((char*)pointer - headerSize, headerSize + newSize);
+		if(large == NULL)
 		{
-			targetIndex = loopIndex;
-			break;
+			return NULL;
+		}
+		if(large->prev != NULL)
+		{
+			large->prev->next = large;
+		}
+		else
+		{
+			pool->larges = large;
+		}
+		if(large->next != NULL)
+		{
+			large->next->prev = large;
 		}
+
+		return (char*)large + headerSize;
+	}
+
+	void *newPointer = poolAllocate(context, newSize);
+	if(newPointer == NULL)
+	{
+		return NULL;
 	}
+	memcpy(newPointer, pointer, (oldSize < newSize) ? oldSize : newSize);
+	poolDeallocate(context, pointer, oldSize);
 
-	return targetIndex;
+	return newPointer;
 }
 
 /**
- * @fn int dynamicIntArrayFind(const dynamicIntArray_t *array, compareInt1Param_f func)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열에서 지정한 조건 함수의 조건과 일치하는 값의 첫 번째 인덱스를 반환하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param func 지정한 조건 함수(입력)
- * @return 성공 시 검색된 인덱스, 검색 실패 시 UNKNOWN, 내부 함수 호출 실패 시 FAIL 반환
+ * @fn static void poolDeallocate(void *context, void *pointer, size_t size)
+ * @brief 풀 할당자의 해제 함수
+ * 크기 등급 조각은 free list 에 돌려주고, 큰 메모리는 목록에서 빼서 바로 해제한다.
+ * @param context 풀 할당자 구조체(입력, 출력, dynamicIntArrayPool_t)
+ * @param pointer 해제할 메모리(입력)
+ * @param size 할당한 크기(입력, 바이트)
+ * @return 반환값 없음
  */
-int dynamicIntArrayFind(const dynamicIntArray_t *array, compareInt1Param_f func)
+static void poolDeallocate(void *context, void *pointer, size_t size)
+{
+	dynamicIntArrayPool_t *pool = (dynamicIntArrayPool_t*)context;
+	if(pointer == NULL)
+	{
+		return;
+	}
+
+	int sizeClass = getPoolClass(size);
+	if(sizeClass == UNKNOWN)
+	{
+		dynamicIntArrayPoolLarge_t *large = (dynamicIntArrayPoolLarge_t*)((char*)pointer - ALLOCATOR_ALIGN_UP(sizeof(dynamicIntArrayPoolLarge_t)));
+		if(large->prev != NULL)
+		{
+			large->prev->next = large->next;
+		}
+		else
+		{
+			pool->larges = large->next;
+		}
+		if(large->next != NULL)
+		{
+			large->next->prev = large->prev;
+		}
+		free(large);
+		return;
+	}
+
+	*(void**)pointer = pool->freeLists[sizeClass];
+	pool->freeLists[sizeClass] = pointer;
+}
+
+/**
+ * @fn static int allocateHugeStorage(dynamicIntArray_t *array, size_t capacity)
+ * @brief 동적 배열을 익명 매핑한 큰 배열 모드 메모리로 할당하는 함수
+ * 매핑 길이는 hugepage 크기 단위로 올림하고 MADV_HUGEPAGE 를 요청해서 페이지 폴트와 TLB 미스를 줄인다.
+ * 매핑 주소는 페이지 경계이므로 원소들은 항상 64 바이트(캐시 라인) 경계에서 시작한다.
+ * 힙에 할당된 원소가 있으면 새 매핑으로 복사한 뒤 해제한다. (큰 배열 모드로 옮길 때 한 번만 복사)
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력, 힙 저장소)
+ * @param capacity 할당할 용량(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int allocateHugeStorage(dynamicIntArray_t *array, size_t capacity)
 {
-	int size = dynamicIntArrayGetSize(array);
-	if(size == UNKNOWN)
+	size_t mapLength = ((capacity * sizeof(int)) + DYNAMIC_INT_ARRAY_HUGE_PAGE_SIZE - 1) & ~(DYNAMIC_INT_ARRAY_HUGE_PAGE_SIZE - 1);
+	void *mapBase = mmap(NULL, mapLength, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(mapBase == MAP_FAILED)
 	{
-		printMsg("dynamicIntArrayGetSize 실패. (dynamicIntArrayFind, array:%p)", DEBUG, 1, array);
+		PRINT_MSG("익명 매핑 실패. (allocateHugeStorage, capacity:%zu, errno:%d)", ERROR, 2, capacity, errno);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
 		return FAIL;
 	}
+#ifdef MADV_HUGEPAGE
+	madvise(mapBase, mapLength, MADV_HUGEPAGE);
+#endif
 
-	int targetIndex = UNKNOWN;
-	int value = UNKNOWN;
-	int loopIndex = 0;
-	int isError = FAIL;
+	if(array->size > capacity)
+	{
+		array->size = capacity;
+	}
 
-	for (; loopIndex < size; loopIndex++)
+	if(array->data != NULL)
 	{
-		value = dynamicIntArrayGetElement(array, loopIndex, &isError);
-		if(isError == FAIL)
+		memcpy(mapBase, array->data, array->size * sizeof(int));
+		if(isInlineStorage(array) == NO)
+		{
+			array->allocator->deallocate(array->allocator->context, array->data, array->capacity * sizeof(int));
+		}
+	}
+
+	array->storageKind = STORAGE_HUGE;
+	array->storageFd = -1;
+	array->storageBase = mapBase;
+	array->storageLength = mapLength;
+	array->data = (int*)mapBase;
+	array->capacity = capacity;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn static int remapHugeStorage(dynamicIntArray_t *array, size_t capacity)
+ * @brief 큰 배열 모드 동적 배열의 용량을 변경하는 함수
+ * 새 용량이 현재 매핑 안에 들어가면 용량만 바꾸고, 아니면 mremap 으로 페이지를 옮겨서 원소를 복사하지 않는다.
+ * 용량이 줄어들어 매핑이 hugepage 단위 이상 남으면 남는 부분을 해제한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력, 큰 배열 저장소)
+ * @param capacity 변경할 용량(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+static int remapHugeStorage(dynamicIntArray_t *array, size_t capacity)
+{
+	size_t mapLength = ((capacity * sizeof(int)) + DYNAMIC_INT_ARRAY_HUGE_PAGE_SIZE - 1) & ~(DYNAMIC_INT_ARRAY_HUGE_PAGE_SIZE - 1);
+	if(mapLength != array->storageLength)
+	{
+#ifdef MREMAP_MAYMOVE
+		void *mapBase = mremap(array->storageBase, array->storageLength, mapLength, MREMAP_MAYMOVE);
+#else
+		void *mapBase = mmap(NULL, mapLength, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(mapBase != MAP_FAILED)
+		{
+			memcpy(mapBase, array->storageBase, (mapLength < array->storageLength) ? mapLength : array->storageLength);
+			munmap(array->storageBase, array->storageLength);
+		}
+#endif
+		if(mapBase == MAP_FAILED)
 		{
-			printMsg("동적 배열 원소 조회 실패. dynamicIntArrayGetElement 실패. (dynamicIntArrayFind)", ERROR, 0);
+			PRINT_MSG("익명 매핑 재할당 실패. (remapHugeStorage, capacity:%zu, errno:%d)", ERROR, 2, capacity, errno);
+			dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
 			return FAIL;
 		}
+#ifdef MADV_HUGEPAGE
+		madvise(mapBase, mapLength, MADV_HUGEPAGE);
+#endif
 
-		if (func(value) == YES)
-		{
-			targetIndex = loopIndex;
-			break;
-		}
+		array->storageBase = mapBase;
+		array->storageLength = mapLength;
+		array->data = (int*)mapBase;
 	}
 
-	return targetIndex;
+	array->capacity = capacity;
+	if(array->size > capacity)
+	{
+		array->size = capacity;
+	}
+
+	return SUCCESS;
 }
 
 /**
- * @fn int dynamicIntArrayReverse(const dynamicIntArray_t *array)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 전체 원소들을 역순으로 저장하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @fn static int remapCapacity(dynamicIntArray_t *array, size_t capacity)
+ * @brief 읽기/쓰기로 매핑한 동적 배열의 파일(또는 공유 메모리) 크기를 바꾸고 다시 매핑해서 용량을 변경하는 함수
+ * 기존 데이터는 유지되며, 용량이 크기보다 작아지면 크기도 용량에 맞춘다.
+ * 공유 메모리는 다른 프로세스가 아직 이전 크기로 매핑하고 있을 수 있으므로 용량을 줄이지 않는다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param capacity 변경할 용량(입력)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-int dynamicIntArrayReverse(const dynamicIntArray_t *array)
+static int remapCapacity(dynamicIntArray_t *array, size_t capacity)
 {
-	int size = dynamicIntArrayGetSize(array);
-	if(size == UNKNOWN)
+	if((array->storageKind != STORAGE_MAPPED_READ_WRITE) && (array->storageKind != STORAGE_SHARED_READ_WRITE))
 	{
-		printMsg("dynamicIntArrayGetSize 실패. (dynamicIntArrayReverse, array:%p)", DEBUG, 1, array);
+		PRINT_MSG("용량을 변경할 수 없는 저장소. (remapCapacity, storageKind:%d)", DEBUG, 1, array->storageKind);
+		dynamicIntArraySetLastError(ERROR_READ_ONLY);
 		return FAIL;
 	}
 
-	int isError = FAIL;
-	int loopIndex = 0;
-	int rightValue = UNKNOWN;
-	int leftValue = UNKNOWN;
-
-	for( ; loopIndex < (size / 2); loopIndex++)
+	if((array->storageKind == STORAGE_SHARED_READ_WRITE) && (capacity < array->capacity))
 	{
-		if((size - (loopIndex + 1)) <= loopIndex) break;
-
-		rightValue = dynamicIntArrayGetElement(array, (size - (loopIndex + 1)), &isError);
-		if(isError == FAIL)
-		{
-			printMsg("동적 배열 원소 조회 실패. dynamicIntArrayGetElement 실패. (dynamicIntArrayReverse)", ERROR, 0);
-			return FAIL;
-		}
-
-		leftValue = dynamicIntArrayGetElement(array, loopIndex, &isError);
-		if(isError == FAIL)
+		if(array->size > capacity)
 		{
-			printMsg("동적 배열 원소 조회 실패. dynamicIntArrayGetElement 실패. (dynamicIntArrayReverse)", ERROR, 0);
-			return FAIL;
-		}
-
-		if(dynamicIntArraySetElement(array, (size - (loopIndex + 1)), leftValue) == FAIL)
-		{
-			printMsg("배열 저장 오류. dynamicIntArraySetElement 동작 실패. (dynamicIntArrayReverse)", DEBUG, 0);
-			return FAIL;
-		}
-
-		if(dynamicIntArraySetElement(array, loopIndex, rightValue) == FAIL)
-		{
-			printMsg("배열 저장 오류. dynamicIntArraySetElement 동작 실패. (dynamicIntArrayReverse)", DEBUG, 0);
-			return FAIL;
+			array->size = capacity;
 		}
+		publishSharedHeader(array);
+		return SUCCESS;
 	}
 
-/*	int reverseLoopIndex = size - 1;
-	dynamicIntArray_t *tempArray;
-
-	if ((tempArray = dynamicIntArrayClone(array)) == NULL)
+	size_t headerLength = (size_t)((char*)array->data - (char*)array->storageBase);
+	size_t mapLength = headerLength + (capacity * sizeof(int));
+	if(ftruncate(array->storageFd, (off_t)mapLength) != 0)
 	{
-		printMsg("배열 복제 오류. dynamicIntArrayClone 동작 실패. (dynamicIntArrayReverse)", DEBUG, 0);
+		PRINT_MSG("파일 크기 변경 실패. (remapCapacity, capacity:%zu, errno:%d)", ERROR, 2, capacity, errno);
+		dynamicIntArraySetLastError(ERROR_IO);
 		return FAIL;
 	}
 
-	for (loopIndex = 0; loopIndex < size; loopIndex++)
+	if(remapStorage(array, mapLength) == FAIL)
 	{
-		tempArrayValue = dynamicIntArrayGetElement(tempArray, reverseLoopIndex, &isError);
-		if(isError == FAIL)
+		PRINT_MSG("remapStorage 실패. (remapCapacity, capacity:%zu)", DEBUG, 1, capacity);
+#ifdef MREMAP_MAYMOVE
+		// mremap 이 실패하면 기존 매핑은 그대로이므로 파일 크기만 되돌린다.
+		if(ftruncate(array->storageFd, (off_t)array->storageLength) != 0)
 		{
-			printMsg("동적 배열 원소 조회 실패. dynamicIntArrayGetElement 실패. (dynamicIntArrayReverse)", ERROR, 0);
-			return FAIL;
+			PRINT_MSG("파일 크기 복구 실패. (remapCapacity, errno:%d)", DEBUG, 1, errno);
 		}
+#endif
+		return FAIL;
+	}
 
-		if(dynamicIntArraySetElement(array, loopIndex, tempArrayValue) == FAIL)
-		{
-			printMsg("배열 저장 오류. dynamicIntArraySetElement 동작 실패. (dynamicIntArrayReverse)", DEBUG, 0);
-			return FAIL;
-		}
+	array->capacity = capacity;
+	if(array->size > capacity)
+	{
+		array->size = capacity;
+	}
 
-		reverseLoopIndex--;
+	// 공유 메모리는 다른 프로세스가 새 용량으로 다시 매핑할 수 있도록 바로 게시한다.
+	if(array->storageKind == STORAGE_SHARED_READ_WRITE)
+	{
+		publishSharedHeader(array);
 	}
 
-	dynamicIntArrayDelete(&tempArray);
-*/
 	return SUCCESS;
 }
 
 /**
- * @fn int dynamicIntArrayFill(const dynamicIntArray_t *array, int datum)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열을 특정 값으로 채우는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param datum 채울 값(입력)
+ * @fn static int remapStorage(dynamicIntArray_t *array, size_t mapLength)
+ * @brief 매핑 저장소를 지정한 길이로 다시 매핑하고 매핑 주소와 원소 주소를 갱신하는 함수
+ * 파일(또는 공유 메모리)의 크기는 호출자가 미리 맞춰야 하며, 용량과 크기는 변경하지 않는다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @param mapLength 새 매핑 길이(입력, 헤더 포함, 바이트)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-int dynamicIntArrayFill(const dynamicIntArray_t *array, int datum)
+static int remapStorage(dynamicIntArray_t *array, size_t mapLength)
 {
-	int *arrayData = dynamicIntArrayGetArrayPtr(array);
-	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayFill)") == YES)
+	size_t headerLength = (size_t)((char*)array->data - (char*)array->storageBase);
+
+#ifdef MREMAP_MAYMOVE
+	void *mapBase = mremap(array->storageBase, array->storageLength, mapLength, MREMAP_MAYMOVE);
+#else
+	int protection = ((array->storageKind == STORAGE_MAPPED_READ_ONLY) || (array->storageKind == STORAGE_SHARED_READ_ONLY)) ? PROT_READ : (PROT_READ | PROT_WRITE);
+	munmap(array->storageBase, array->storageLength);
+	void *mapBase = mmap(NULL, mapLength, protection, MAP_SHARED, array->storageFd, 0);
+#endif
+	if(mapBase == MAP_FAILED)
 	{
+		PRINT_MSG("다시 매핑 실패. (remapStorage, length:%zu, errno:%d)", ERROR, 2, mapLength, errno);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_MEMORY);
 		return FAIL;
 	}
 
-	int size = array->size;
-	int loopIndex = 0;
-	for( ; loopIndex < size; loopIndex++)
-	{
-		arrayData[loopIndex] = datum;
-	}
+	array->storageBase = mapBase;
+	array->storageLength = mapLength;
+	array->data = (int*)((char*)mapBase + headerLength);
 
 	return SUCCESS;
 }
 
 /**
- * @fn int *dynamicIntArrayGetArrayPtr(const dynamicIntArray_t *array)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 주소를 반환하는 함수
+ * @fn static void updateMappedHeader(const dynamicIntArray_t *array)
+ * @brief 읽기/쓰기로 매핑한 파일의 헤더에 현재 원소 개수를 기록하고 헤더 체크섬을 다시 계산하는 함수
  * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @return 성공 시 구조체 포인터가 가지고 있는 동적 배열의 주소, 실패 시 NULL 반환
+ * @return 반환값 없음
  */
-int *dynamicIntArrayGetArrayPtr(const dynamicIntArray_t *array)
+static void updateMappedHeader(const dynamicIntArray_t *array)
 {
-	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetArrayPtr)") == YES)
-	{
-		return NULL;
-	}
+	dynamicIntArrayFileHeader_t *header = (dynamicIntArrayFileHeader_t*)array->storageBase;
 
-	return array->data;
+	header->flags = (uint8_t)(header->flags | FILE_FLAG_UNCHECKED);
+	header->count = (uint64_t)array->size;
+	header->checksum = 0;
+	header->headerChecksum = updateChecksum(1, header, offsetof(dynamicIntArrayFileHeader_t, headerChecksum));
 }
 
 /**
- * @fn int dynamicIntArrayGetSize(const dynamicIntArray_t *array)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 전체 크기를 반환하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @return 성공 시 동적 배열의 전체 크기, 실패 시 UNKNOWN 반환
+ * @fn static void publishSharedHeader(dynamicIntArray_t *array)
+ * @brief 공유 메모리 헤더에 현재 크기와 용량을 기록하고 세대 번호를 증가시켜 다른 프로세스에 게시하는 함수
+ * 세대 번호는 release 순서로 증가시키므로, 새 세대 번호를 본 프로세스는 그 전에 쓴 원소들도 볼 수 있다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 출력)
+ * @return 반환값 없음
  */
-int dynamicIntArrayGetSize(const dynamicIntArray_t *array)
+static void publishSharedHeader(dynamicIntArray_t *array)
 {
-	if(checkObjectNull(array, "메모리 참조 실패, 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayGetSize)") == YES)
-	{
-		return UNKNOWN;
-	}
+	dynamicIntArraySharedHeader_t *header = (dynamicIntArraySharedHeader_t*)array->storageBase;
 
-	return array->size;
+	__atomic_store_n(&header->size, (uint64_t)array->size, __ATOMIC_RELAXED);
+	__atomic_store_n(&header->capacity, (uint64_t)array->capacity, __ATOMIC_RELAXED);
+	// 자신이 게시한 세대 번호를 기록해서 dynamicIntArrayRefresh 가 게시하지 않은 변경을 덮어쓰지 않게 한다.
+	array->storageGeneration = __atomic_add_fetch(&header->generation, 1, __ATOMIC_RELEASE);
 }
 
 /**
- * @fn int dynamicIntArrayCopy(dynamicIntArray_t *dst, int dstIndex, dynamicIntArray_t *src, int srcIndex, int size)
- * @brief 하나의 동적 배열 관리 구조체의 동적 배열을 다른 동적 배열 관리 구조체의 동적 배열로 복사하는 함수
- * @param dst 복사될 동적 배열 관리 구조체 포인터(출력, 읽기 전용)
- * @param dstIndex 복사될 배열의 시작 인덱스(입력)
- * @param src 복사할 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param srcIndex 복사할 배열의 시작 인덱스(입력)
- * @param size 복사할 크기(입력)
+ * @fn static int growCapacity(dynamicIntArray_t *array, size_t requiredSize)
+ * @brief 동적 배열의 용량이 요구 크기보다 작을 때만 용량 증가 정책에 따라 용량을 늘리는 함수
+ * 용량은 배수로 증가하므로 원소 추가 비용이 분할 상환 O(1) 이 된다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param requiredSize 저장해야 하는 원소 개수(입력)
  * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-int dynamicIntArrayCopy(const dynamicIntArray_t *dst, int dstIndex, const dynamicIntArray_t *src, int srcIndex, int size)
+static int growCapacity(dynamicIntArray_t *array, size_t requiredSize)
 {
-	if(size <= 0)
+	if((requiredSize == 0) || (requiredSize > DYNAMIC_INT_ARRAY_MAX_SIZE))
 	{
-		printMsg("복사 실패. 복사할 크기가 0. (dynamicIntArrayCopy, size:%d)", DEBUG, 1, size);
+		PRINT_MSG("요구 크기 오류. 요구 크기가 0 이거나 최대 크기 초과(overflow). (growCapacity, requiredSize:%zu)", DEBUG, 1, requiredSize);
+		dynamicIntArraySetLastError(ERROR_OUT_OF_RANGE);
 		return FAIL;
 	}
 
-	if(dynamicIntArrayCheckBoundary(dst, dstIndex) == FAIL)
+	if(requiredSize <= array->capacity)
 	{
-		printMsg("복사 실패. destination 인덱스 오류. (dynamicIntArrayCopy)", ERROR, 0);
-		return FAIL;
+		return SUCCESS;
 	}
 
-	if(dynamicIntArrayCheckBoundary(src, srcIndex) == FAIL)
+	// 최대 크기를 넘지 않도록 곱하기 전에 검사한다.
+	size_t growthFactor = (size_t)array->growthFactor;
+	size_t capacity = (array->capacity > (DYNAMIC_INT_ARRAY_MAX_SIZE / growthFactor)) ? DYNAMIC_INT_ARRAY_MAX_SIZE : (array->capacity * growthFactor / 100);
+	if((capacity - array->capacity) < (size_t)array->growthMinIncrement)
 	{
-		printMsg("복사 실패. source 인덱스 오류. (dynamicIntArrayCopy)", ERROR, 0);
-		return FAIL;
+		capacity = array->capacity + (size_t)array->growthMinIncrement;
 	}
 
-	int srcSize = src->size;
-	if(size > (srcSize - srcIndex))
+	if((array->growthMaxSlack > 0) && (capacity > requiredSize) && ((capacity - requiredSize) > (size_t)array->growthMaxSlack))
 	{
-		printMsg("복사하려는 크기가 지정한 인덱스부터 배열의 마지막까지의 크기보다 큼. (dynamicIntArrayCopy, size:%d, srcSize:%d, srcIndex:%d)", DEBUG, 3, size, srcSize, srcIndex);
-		return FAIL;
+		capacity = requiredSize + (size_t)array->growthMaxSlack;
 	}
 
-	int dstSize = dst->size;
-	if(size > (dstSize - dstIndex))
+	if(capacity < requiredSize)
 	{
-		printMsg("복사하려는 크기가 지정한 인덱스부터 배열의 마지막까지의 크기보다 큼. (dynamicIntArrayCopy, size:%d, dstSize:%d, dstIndex:%d)", DEBUG, 3, size, dstSize, dstIndex);
-		return FAIL;
+		capacity = requiredSize;
 	}
 
-	int *dstArrayData = dst->data;
-	int *srcArrayData = src->data;
-
-	dstArrayData += dstIndex;
-	srcArrayData += srcIndex;
+	if(capacity < DYNAMIC_INT_ARRAY_MIN_CAPACITY)
+	{
+		capacity = DYNAMIC_INT_ARRAY_MIN_CAPACITY;
+	}
 
-	while (size--)
+	if(capacity > DYNAMIC_INT_ARRAY_MAX_SIZE)
 	{
-		*dstArrayData++ = *srcArrayData++;
+		capacity = DYNAMIC_INT_ARRAY_MAX_SIZE;
 	}
 
-	return SUCCESS;
+	return reallocateCapacity(array, capacity);
 }
 
 /**
- * @fn dynamicIntArray_t *dynamicIntArrayClone(const dynamicIntArray_t *original)
- * @brief 하나의 동적 배열 관리 구조체를 새로운 동적 배열 관리 구조체에 복제하는 함수
- * @param original 복제할 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @return 성공 시 새로 복제된 동적 배열 관리 구조체, 실패 시 NULL 반환
+ * @fn static int shrinkCapacity(dynamicIntArray_t *array)
+ * @brief 동적 배열의 크기가 용량의 1/DYNAMIC_INT_ARRAY_SHRINK_DIVISOR 이하로 줄어들었을 때만 용량을 줄이는 함수
+ * 줄어든 용량은 크기에 용량 증가 배율을 곱한 값으로 설정되므로
+ * 경계 근처에서 추가와 삭제를 반복해도 재할당이 반복되지 않는다. (hysteresis)
+ * 예약된 용량보다 작게는 줄이지 않는다.
+ * 실패해도 동적 배열은 기존 용량으로 남아 있으므로 호출자는 실패를 무시할 수 있다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
  */
-dynamicIntArray_t *dynamicIntArrayClone(const dynamicIntArray_t *original)
+static int shrinkCapacity(dynamicIntArray_t *array)
 {
-	int size = dynamicIntArrayGetSize(original);
-	if(size == UNKNOWN)
-	{
-		printMsg("dynamicIntArrayGetSize 실패. (dynamicIntArrayClone, array:%p)", DEBUG, 1, original);
-		return NULL;
-	}
-
-	dynamicIntArray_t *new = dynamicIntArrayNew(size);
-	if(checkObjectNull(new, "메모리 생성 실패, 새 동적 배열 관리 구조체 포인터가 NULL. (dynamicIntArrayClone)") == YES)
+	size_t capacity = array->capacity;
+	if((capacity <= DYNAMIC_INT_ARRAY_MIN_CAPACITY)
+			|| (isInlineStorage(array) == YES)
+			|| (capacity <= array->reservedCapacity)
+			|| (array->size > (capacity / DYNAMIC_INT_ARRAY_SHRINK_DIVISOR)))
 	{
-		return NULL;
+		return SUCCESS;
 	}
 
-	if (dynamicIntArrayCopy(new, 0, original, 0, size) == FAIL)
+	// 크기가 용량의 일부 이하이므로 곱해도 넘치지 않는다.
+	size_t newCapacity = array->size * (size_t)array->growthFactor / 100;
+	if(newCapacity < (array->size + (size_t)array->growthMinIncrement))
 	{
-		printMsg("동적 배열 관리 구조체 복사 실패. (dynamicIntArrayClone, new:%p, original:%p, size:%d)", DEBUG, 3, new, original, size);
-		dynamicIntArrayDelete(&new);
-		return NULL;
+		newCapacity = array->size + (size_t)array->growthMinIncrement;
 	}
 
-	if(checkObjectNull(original->stringOfArray, NULL) == NO)
+	if(newCapacity < array->reservedCapacity)
 	{
-		size_t arrayLength = strlen(original->stringOfArray);
-		new->stringOfArray = (char*)calloc(arrayLength, sizeof(char));
-		if(checkObjectNull(new->stringOfArray, "메모리 생성 실패, 새로 생성한 문자열이 NULL. (dynamicIntArrayClone)") == YES)
-		{
-			dynamicIntArrayDelete(&new);
-			return NULL;
-		}
-		strncpy(new->stringOfArray, original->stringOfArray, arrayLength);
+		newCapacity = array->reservedCapacity;
 	}
 
-	return new;
-}
-
-/**
- * @fn int dynamicIntArrayCheckBoundary(const dynamicIntArray_t *array, int index)
- * @brief 동적 배열 관리 구조체가 관리하는 동적 배열의 바운더리에 지정한 인덱스가 허용되는지 검사하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
- * @param index 검사할 인덱스(입력)
- * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
- */
-int dynamicIntArrayCheckBoundary(const dynamicIntArray_t *array, int index)
-{
-	int size = dynamicIntArrayGetSize(array);
-	if(size == UNKNOWN)
+	if(newCapacity < DYNAMIC_INT_ARRAY_MIN_CAPACITY)
 	{
-		printMsg("dynamicIntArrayGetSize 실패. (dynamicIntArrayCheckBoundary, array:%p)", DEBUG, 1, array);
-		return FAIL;
+		newCapacity = DYNAMIC_INT_ARRAY_MIN_CAPACITY;
 	}
 
-	if ((index < 0) || (index >= size))
+	if(newCapacity >= capacity)
 	{
-		printMsg("동적 배열의 인덱스 바운더리 오류. (dynamicIntArrayCheckBoundary, index:%d, range:0~%d)", DEBUG, 2, index, size);
-		return FAIL;
+		return SUCCESS;
 	}
 
-	return SUCCESS;
+	return reallocateCapacity(array, newCapacity);
 }
 
 /**
- * @fn char *dynamicIntArrayToString(dynamicIntArray_t *array)
- * @brief 동적 배열의 모든 원소를 담고 있는 문자열을 반환하는 함수
- * @param array 동적 배열 관리 구조체 포인터(입력)
- * @return 성공 시 생성한 문자열, 실패 시 NULL 반환
+ * @fn static void printRecordMsg(int type, const char *msg, va_list argPointer)
+ * @brief 메시지를 현재 쓰레드의 출력 링 버퍼 슬롯에 형식화해서 기록하는 함수
+ * 메시지는 슬롯에 한 번만 형식화하며, 슬롯보다 긴 메시지는 잘라서 끝에 "..." 을 붙인다.
+ * @param type 출력 형태(입력, PRINT_TYPE 열거형 참고)
+ * @param msg 형식 문자열(입력, 읽기 전용)
+ * @param argPointer 가변 인자 목록(입력)
+ * @return 반환값 없음
  */
-char *dynamicIntArrayToString(dynamicIntArray_t *array)
+static void printRecordMsg(int type, const char *msg, va_list argPointer)
 {
-	int *arrayData = dynamicIntArrayGetArrayPtr(array);
-	if(checkObjectNull(arrayData, "메모리 참조 실패, 동적 배열이 NULL. (dynamicIntArrayToString)") == YES)
-	{
-		return NULL;
-	}
-
-	int size = array->size;
-	int sumOfDigits = 0;
-	int loopIndex = 0;
-	int stringLength = 0;
-	char *string = NULL;
+	printRing_t *ring = &printThreadRing;
 
-	// 1. 동적 배열에 담긴 숫자들을 문자열로 변환하기 위해서 자리수를 모두 더한 값을 구한다.
-	for( ; loopIndex < size; loopIndex++)
+	// 링 버퍼가 가득 차면 오래된 메시지부터 sink 로 전달해서 슬롯을 비운다.
+	if(ring->count == PRINT_RING_SLOT_COUNT)
 	{
-		sumOfDigits += getDigitOfNumber(arrayData[loopIndex]);
+		printFlush();
 	}
 
-	// 생성할 문자열의 총 길이를 계산한다.
-	// [총 길이] = [모든 원소들의 자리수 합] + [동적 배열의 전체 크기(size) * 2 + 3]
-	// [size * 2 + 2] : [쉼표 개수(size 보다 1개 적다. size - 1)] + [공백 개수(size 만큼 있고 앞에 하나 더 있다. size + 1)] + [중괄호 개수(2)] + [널 문자(1)]
-	stringLength = sumOfDigits + (size * 2 + 3);
+	unsigned int slot = (ring->tail + ring->count) % PRINT_RING_SLOT_COUNT;
+	printRecord_t *record = &(ring->records[slot]);
 
-	// 2. 동적 배열 관리 구조체 최초 생성 시 문자열이 생성되지 않으므로 
-	// 함수 최초 호출 시 생성하도록 한다.
-	if(checkObjectNull(array->stringOfArray, NULL) == YES)
+	int length = vsnprintf(record->text, sizeof(record->text), msg, argPointer);
+	if(length < 0)
 	{
-		string = (char*)calloc((size_t)stringLength, sizeof(char));
-		if(checkObjectNull(string, "메모리 참조 실패, 새로 생성한 문자열이 NULL. (dynamicIntArrayToString)") == YES)
-		{
-			return NULL;
-		}
+		// 형식화에 실패한 메시지 대신 실패 원인을 기록한다. (다시 형식화에 실패할 수 있으므로 printDiagnosticMsg 를 호출하지 않음)
+		snprintf(record->text, sizeof(record->text), "출력 실패. vsnprintf 함수 동작 오류. (printRecordMsg, type:%d)", type);
+		type = DEBUG;
 	}
-	// 이전에 한 번 이상 호출되었다면, 새로운 크기로 재생성하고 내용을 모두 지운다.
-	else
+	else if((size_t)length >= sizeof(record->text))
 	{
-		string = (char*)realloc(array->stringOfArray, (size_t)stringLength);
-		if(checkObjectNull(string, "메모리 참조 실패, 재생성한 문자열이 NULL. (dynamicIntArrayToString)") == YES)
+		// UTF-8 문자 중간에서 잘리지 않도록 이어지는 바이트(10xxxxxx)가 아닌 곳까지 물러나서 표시를 붙인다.
+		size_t cut = sizeof(record->text) - sizeof("...");
+		while((cut > 0) && ((record->text[cut] & 0xC0) == 0x80))
 		{
-			return NULL;
+			cut--;
 		}
-		memset(string, 0, strlen(string));
+		memcpy(record->text + cut, "...", sizeof("..."));
 	}
 
-	// 3. 생성한 문자열에 동적 배열에 저장된 값을 하나씩 문자열로 변환해서 추가한다.
-	loopIndex = 0;
-	string[loopIndex] = '{';
-	for (; loopIndex < size; loopIndex++)
+	record->type = type;
+	ring->count++;
+
+	if(atomic_load_explicit(&printIsBuffered, memory_order_relaxed) == NO)
 	{
-		if(addNumberToString(string, arrayData[loopIndex]) == FAIL)
-		{
-			return NULL;
-		}
-		if ((loopIndex + 1) < size) strcat(string, ",");
+		printFlush();
+	}
+	else
+	{
+		registerPrintRing(ring);
 	}
-	strcat(string, " }");
-
-	array->stringOfArray = string;
-	return string;
 }
 
-///////////////////////////////////////////////////////////////////////////////////////
-/// Common Util Functions
-///////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @fn static void printDiagnosticMsg(const char *msg, ...)
+ * @brief 출력 함수의 잘못된 사용을 출력 수준과 관계없이 DEBUG 메시지로 기록하는 함수
+ * 다른 메시지와 같은 출력 링 버퍼와 sink 를 거친다.
+ * @param msg 형식 문자열(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void printDiagnosticMsg(const char *msg, ...)
+{
+	va_list argPointer;
+	va_start(argPointer, msg);
+	printRecordMsg(DEBUG, msg, argPointer);
+	va_end(argPointer);
+}
 
 /**
- * @fn void printMsg(const char *msg, int type, int argc, ...)
- * @brief 메시지를 출력하는 함수
- * @param msg 출력할 문자열(입력, 읽기 전용)
+ * @fn static void printToSink(int type, const char *text)
+ * @brief 형식화된 메시지를 현재 설정된 출력 sink 로 전달하는 함수
+ * sink 함수를 acquire 로 읽으므로 printSetSink 가 함께 저장한 사용자 데이터를 본다.
  * @param type 출력 형태(입력, PRINT_TYPE 열거형 참고)
- * @param argc 가변 인자 개수(입력)
+ * @param text 형식화된 메시지(입력, 읽기 전용)
  * @return 반환값 없음
  */
-void printMsg(const char *msg, int type, int argc, ...)
+static void printToSink(int type, const char *text)
 {
-	if((type < UNKNOWN) && (type > YES))
-	{
-		printf("[DEBUG] 출력 실패. 알 수 없는 메시지 타입. (printMsg, type:%d)\n", type);
-		return;
-	}
+	printSink_f sink = atomic_load_explicit(&printSink, memory_order_acquire);
+	sink(type, text, atomic_load_explicit(&printSinkContext, memory_order_relaxed));
+}
 
-	if(argc < 0)
+/**
+ * @fn static void flushPrintRing(printRing_t *ring)
+ * @brief 출력 링 버퍼에 쌓인 메시지를 오래된 순서대로 모두 sink 로 전달하는 함수
+ * @param ring 비울 출력 링 버퍼(입력, 출력)
+ * @return 반환값 없음
+ */
+static void flushPrintRing(printRing_t *ring)
+{
+	while(ring->count > 0)
 	{
-		printf("[DEBUG] 출력 실패. 출력문 매개변수 개수가 음수. (printMsg, argc:%d)\n", argc);
-		return;
+		printRecord_t *record = &(ring->records[ring->tail]);
+		printToSink(record->type, record->text);
+		ring->tail = (ring->tail + 1) % PRINT_RING_SLOT_COUNT;
+		ring->count--;
 	}
+}
 
-	va_list argPointer;
-	va_start(argPointer, argc);
-
-	int size = getBufferSize(msg, argPointer);
-	if(size == FAIL)
+/**
+ * @fn static void registerPrintRing(printRing_t *ring)
+ * @brief 쓰레드가 끝날 때 출력 링 버퍼가 비워지도록 쓰레드 키에 등록하는 함수
+ * 쓰레드 키를 처음 만들 때 프로세스 종료 시 링 버퍼를 비우는 함수도 함께 등록한다.
+ * 등록하지 못하면 printFlush 를 호출하기 전까지 메시지가 남아 있을 뿐이므로 실패를 따로 알리지 않는다.
+ * @param ring 호출한 쓰레드의 출력 링 버퍼(입력, 출력)
+ * @return 반환값 없음
+ */
+static void registerPrintRing(printRing_t *ring)
+{
+	if(ring->isRegistered == YES)
 	{
-		printf("[ERROR] 가변 인자를 포함한 문자열의 길이 계산 실패. (printMsg)\n");
-		va_end(argPointer);
 		return;
 	}
 
-	char printBuffer[size];
-	memset(printBuffer, 0, sizeof(printBuffer));
-
-	int isErrorForVSN = vsnprintf(printBuffer, sizeof(printBuffer), msg, argPointer);
-	if(isErrorForVSN < 0 // for glibc < 2.1
-			|| (size_t)isErrorForVSN >= sizeof(printBuffer)) // for glibc >= 2.1
+	if((pthread_once(&printRingKeyOnce, createPrintRingKey) != 0) || (isPrintRingKeyCreated == NO))
 	{
-#if IS_PRINT_DEBUG
-		printf("[DEBUG] 출력 실패. vsnprintf 함수 동작 오류.\n");
-		printf("(printMsg, returnValue:[%d], printBuffer:[%s], size:[%d], msg:[%s], argc:[%d], type:[%d])\n", isErrorForVSN, printBuffer, size, msg, argc, type);
-#endif
 		return;
 	}
 
-	if (type == NORMAL)
-	{
-		printf("%s\n", printBuffer);
-	}
-#if IS_PRINT_DEBUG
-	else if (type == DEBUG)
+	if(pthread_setspecific(printRingKey, ring) == 0)
 	{
-		printf("[DEBUG] %s\n", printBuffer);
+		ring->isRegistered = YES;
 	}
-#endif
-#if IS_PRINT_ERROR
-	else if (type == ERROR)
-	{
-		printf("[ERROR] %s\n", printBuffer);
-	}
-#endif
-
-	va_end(argPointer);
 }
 
 /**
- * @fn int checkObjectNull(const void *object, const char *msg)
- * @brief 객체가 NULL 인지 검사하는 함수
- * @param object 검사할 객체(입력, 읽기 전용)
- * @param msg 출력할 오류 문자열(입력, 읽기 전용)
- * @return NULL 이 아니면 NO, NULL 이면 YES 반환
+ * @fn static void createPrintRingKey(void)
+ * @brief 출력 링 버퍼를 비우는 쓰레드 키를 한 번 생성하고 프로세스 종료 처리 함수를 등록하는 함수 (pthread_once 에서 호출)
+ * @return 반환값 없음
  */
-int checkObjectNull(const void *object, const char *msg)
+static void createPrintRingKey(void)
 {
-	if (object == NULL)
+	if(pthread_key_create(&printRingKey, releasePrintRing) == 0)
 	{
-		if(msg != NULL) printMsg(msg, DEBUG, 0);
-		return YES;
+		isPrintRingKeyCreated = YES;
 	}
-	return NO;
-}
 
-//////////////////////////////////////////////////////////////////////////////////////
-/// Static Util Functions
-///////////////////////////////////////////////////////////////////////////////////////
+	// 쓰레드 키 소멸자는 exit 를 호출한 쓰레드(보통 main 쓰레드)에서는 실행되지 않으므로 따로 등록한다.
+	atexit(flushPrintRingAtExit);
+}
 
 /**
- * @fn static int getBufferSize(const char *format, ...)
- * @brief 가변 인자가 포함된 문자열의 총 길이를 계산하여 반환하는 함수
- * @param msg 가변 인자가 포함된 문자열(입력, 읽기 전용) 
- * @return 성공 시 문자열의 총 길이, 실패 시 FAIL 반환
+ * @fn static void releasePrintRing(void *context)
+ * @brief 쓰레드가 끝날 때 그 쓰레드의 출력 링 버퍼에 남은 메시지를 전달하는 함수 (쓰레드 키 소멸자)
+ * 이후에 다시 쌓이면 다시 등록해서 비워지도록 등록 여부를 지운다.
+ * @param context 끝나는 쓰레드의 출력 링 버퍼(입력, 출력, printRing_t)
+ * @return 반환값 없음
  */
-static int getBufferSize(const char *msg, ...)
+static void releasePrintRing(void *context)
 {
-	if(checkObjectNull(msg, "메모리 참조 실패, 메시지 문자열이 NULL. (getBufferSize)") == YES)
-	{
-		return FAIL;
-	}
-
-	va_list args;
-	va_start(args, msg);
-
-	int result = vsnprintf(NULL, 0, msg, args);
-	if(result < 0)
-	{
-		return FAIL;
-	}
-
-	va_end(args);
-
-	return (result + 1); // [+1] : for NULL character
+	printRing_t *ring = (printRing_t*)context;
+	flushPrintRing(ring);
+	ring->isRegistered = NO;
 }
 
 /**
- * @fn static int getDigitOfNumber(int number)
- * @brief 정수의 자리수를 계산해서 반환하는 함수
- * 음수이면 '-' 부호도 자리수에 포함한다.
- * @param number 자리수를 계산할 정수(입력)
- * @return 항상 숫자의 자리수 반환
+ * @fn static void flushPrintRingAtExit(void)
+ * @brief 프로세스가 종료될 때 exit 를 호출한 쓰레드의 출력 링 버퍼에 남은 메시지를 전달하는 함수 (atexit 에서 호출)
+ * @return 반환값 없음
  */
-static int getDigitOfNumber(int number)
+static void flushPrintRingAtExit(void)
 {
-	int countOfDigit = 0;
-
-	if(number < 0) countOfDigit++;
-	else if(number == 0) return 1;
-
-	while(number != 0)
-	{
-		countOfDigit++;
-		number /= 10;
-	}
-
-	return countOfDigit;
-
-	/* if (sprintf(buf, "%d", number) < 0)
-	   {
-	   return FAIL;
-	   }
-	   return strlen(buf); */
+	printFlush();
 }
 
 /**
- * @fn static int addNumberToString(char *string, int number)
- * @brief 정수를 문자열로 변환해서 전달받은 문자열에 추가하는 함수
- * @param string 추가될 문자열(출력)
- * @param number 추가할 정수(입력)
- * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ * @fn static void printDefaultSink(int type, const char *text, void *context)
+ * @brief 메시지를 출력 형태에 맞는 머리말과 함께 표준 출력으로 출력하는 기본 sink 함수
+ * @param type 출력 형태(입력, PRINT_TYPE 열거형 참고)
+ * @param text 형식화된 메시지(입력, 읽기 전용)
+ * @param context 사용하지 않음
+ * @return 반환값 없음
  */
-static int addNumberToString(char *string, int number)
+static void printDefaultSink(int type, const char *text, void *context)
 {
-	if(checkObjectNull(string, "메모리 참조 실패, 추가될 문자열이 NULL. (addNumberToString)") == YES)
+	(void)context;
+
+	if (type == NORMAL)
 	{
-		return FAIL;
+		printf("%s\n", text);
 	}
-
-	int digitOfNumber = getDigitOfNumber(number);
-	char buf[digitOfNumber + 1];
-	int result = sprintf(buf, " %d", number);
-	if(result < 0)
+#if IS_PRINT_DEBUG
+	else if (type == DEBUG)
 	{
-		printMsg("snprintf 함수 동작 오류. (addNumberToString, returnValue:%d)", DEBUG, 1, result);
-		return FAIL;
+		printf("[DEBUG] %s\n", text);
 	}
-	strcat(string, buf);
-
-	return SUCCESS;
+#endif
+#if IS_PRINT_ERROR
+	else if (type == ERROR)
+	{
+		printf("[ERROR] %s\n", text);
+	}
+#endif
 }
-
@@ -4,8 +4,20 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdarg.h>
 #include <malloc.h>
+#include <assert.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 ///////////////////////////////////////////////////////////////////////////////////////
 /// Definitions & Macros
@@ -16,9 +28,91 @@
 // 프로그램 에러 출력 여부 매크로 상수
 #define IS_PRINT_ERROR	1
 
+// 출력 링 버퍼의 쓰레드별 슬롯 개수 매크로 상수
+#define PRINT_RING_SLOT_COUNT	32
+// 출력 링 버퍼 슬롯 하나의 크기 매크로 상수 (널 문자를 포함해서 이보다 긴 메시지는 잘린다)
+#define PRINT_RING_SLOT_SIZE	256
+
+// 출력 형태가 컴파일 시점에 활성화되어 있는지 확인하는 매크로 함수
+#define PRINT_IS_ENABLED_AT_COMPILE(type) \
+	(((((type) == DEBUG) && (IS_PRINT_DEBUG == 0)) || (((type) == ERROR) && (IS_PRINT_ERROR == 0))) ? NO : YES)
+
+// 라이브러리 내부에서 사용하는 메시지 출력 매크로 함수
+// 컴파일 시점과 실행 시점의 출력 수준을 먼저 검사하므로, 걸러지는 메시지는 함수 호출과 인자 형식화가 모두 생략된다.
+#define PRINT_MSG(msg, type, ...) \
+	do \
+	{ \
+		if((PRINT_IS_ENABLED_AT_COMPILE(type) == YES) && (printIsEnabled(type) == YES)) \
+		{ \
+			printMsg((msg), (type), __VA_ARGS__); \
+		} \
+	} while(0)
+
+// 검사하지 않는 빠른 원소 접근 함수(dynamicIntArrayGetUnchecked, dynamicIntArraySetUnchecked)의
+// 바운더리 검사 여부 매크로 상수 (디버그 빌드에서 컴파일 옵션으로 1 을 지정하면 assert 로 검사)
+#ifndef DYNAMIC_INT_ARRAY_CHECK_UNCHECKED_ACCESS
+#define DYNAMIC_INT_ARRAY_CHECK_UNCHECKED_ACCESS	0
+#endif
+
+// 동적 배열 기본 용량 증가 배율 매크로 상수 (백분율, 용량이 부족하면 현재 용량의 N% 로 증가)
+#define DYNAMIC_INT_ARRAY_GROWTH_FACTOR			200
+// 동적 배열 기본 용량 최소 증가량 매크로 상수 (원소 개수)
+#define DYNAMIC_INT_ARRAY_GROWTH_MIN_INCREMENT	4
+// 동적 배열 기본 용량 최대 여유 공간 매크로 상수 (원소 개수, 0 이면 제한 없음)
+#define DYNAMIC_INT_ARRAY_GROWTH_MAX_SLACK		0
+// 동적 배열 용량 축소 기준 매크로 상수 (크기가 용량의 1/N 이하로 줄어들면 축소)
+#define DYNAMIC_INT_ARRAY_SHRINK_DIVISOR		4
+// 동적 배열 최소 용량 매크로 상수
+#define DYNAMIC_INT_ARRAY_MIN_CAPACITY			4
+// 동적 배열 관리 구조체 안에 원소를 저장하는 인라인 저장소 용량 매크로 상수 (원소 개수, 컴파일할 때 -D 로 변경, 0 이면 사용 안 함)
+#ifndef DYNAMIC_INT_ARRAY_INLINE_CAPACITY
+#define DYNAMIC_INT_ARRAY_INLINE_CAPACITY		16
+#endif
+// 동적 배열 최대 크기 매크로 상수 (원소 개수, 바이트 크기가 ptrdiff_t 범위를 넘지 않도록 제한)
+#define DYNAMIC_INT_ARRAY_MAX_SIZE				((size_t)PTRDIFF_MAX / sizeof(int))
+// 64 비트 검색 함수들이 값을 찾지 못했을 때 반환하는 인덱스 매크로 상수 (STATUS 열거형 값들과 겹치지 않음)
+#define DYNAMIC_INT_ARRAY_NPOS					((size_t)-1)
+// 아레나 할당자의 기본 블록 크기 매크로 상수 (바이트)
+#define DYNAMIC_INT_ARRAY_ARENA_BLOCK_SIZE		((size_t)64 << 10)
+// 풀 할당자의 크기 등급 개수 매크로 상수 (16 바이트부터 2 배씩, 16 ~ 64K 바이트)
+#define DYNAMIC_INT_ARRAY_POOL_CLASS_COUNT		13
+// 풀 할당자의 가장 작은 크기 등급 매크로 상수 (바이트)
+#define DYNAMIC_INT_ARRAY_POOL_MIN_CLASS_SIZE	((size_t)16)
+// 풀 할당자가 크기 등급 조각들을 잘라 쓰는 slab 크기 매크로 상수 (바이트, 가장 큰 크기 등급 이상)
+#define DYNAMIC_INT_ARRAY_POOL_SLAB_SIZE		((size_t)256 << 10)
+// 기본 할당자의 쓰레드별 재사용 캐시 크기 등급 개수 매크로 상수 (16 바이트부터 2 배씩, 16 ~ 4K 바이트)
+#define DYNAMIC_INT_ARRAY_RECYCLE_CLASS_COUNT	9
+// 기본 할당자의 쓰레드별 재사용 캐시가 크기 등급(과 구조체 목록)마다 보관하는 기본 최대 개수 매크로 상수 (dynamicIntArraySetRecycleLimit 참고)
+#define DYNAMIC_INT_ARRAY_RECYCLE_LIMIT			64
+// 큰 배열 모드로 전환하는 기본 크기 매크로 상수 (바이트, dynamicIntArraySetHugeThreshold 참고)
+#define DYNAMIC_INT_ARRAY_HUGE_THRESHOLD		((size_t)32 << 20)
+// 큰 배열 모드의 매핑 길이 단위 매크로 상수 (바이트, transparent hugepage 크기)
+#define DYNAMIC_INT_ARRAY_HUGE_PAGE_SIZE		((size_t)2 << 20)
+
+// 동적 배열을 문자열로 출력할 때 한 번에 형식화해서 내보내는 최대 크기 매크로 상수 (바이트)
+#define DYNAMIC_INT_ARRAY_FORMAT_CHUNK_SIZE		4096
+
+// 동적 배열 이진 파일 식별자 매크로 상수 (4 바이트)
+#define DYNAMIC_INT_ARRAY_FILE_MAGIC			"DIAB"
+// 동적 배열 이진 파일 형식 버전 매크로 상수
+#define DYNAMIC_INT_ARRAY_FILE_VERSION			1
+// 동적 배열 이진 파일을 읽고 쓰는 블록 하나의 원소 개수 매크로 상수 (블록 체크섬 단위)
+#define DYNAMIC_INT_ARRAY_FILE_BLOCK_SIZE		65536
+
+// 공유 메모리 동적 배열 식별자 매크로 상수 (4 바이트)
+#define DYNAMIC_INT_ARRAY_SHARED_MAGIC			"DIAS"
+// 공유 메모리 동적 배열 헤더 형식 버전 매크로 상수
+#define DYNAMIC_INT_ARRAY_SHARED_VERSION		1
+
+// 컴파일된 조건 서술자의 최대 단계 수 매크로 상수 (비교 하나와 결합 연산 하나가 각각 한 단계)
+#define DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS	16
+// 조건 서술자로 필터링할 때 출력 용량을 확보하는 원소 개수 단위 매크로 상수
+#define DYNAMIC_INT_ARRAY_FILTER_CHUNK_SIZE		4096
+
 // 프로그램 출력 열거형
 enum PRINT_TYPE
 {
+	QUIET	= -2,	// 출력 안 함 (출력 수준 설정 전용)
 	ERROR	= -1,	// 에러 메시지
 	NORMAL	= 0,	// 정상 메시지
 	DEBUG	= 1	// 디버그 메시지
@@ -35,19 +129,329 @@ enum STATUS
 	YES		= 1	// 예
 };
 
+// 라이브러리 오류 코드 열거형 (dynamicIntArrayGetLastError 참고)
+enum ERROR_CODE
+{
+	ERROR_NONE				= 0,	// 오류 없음
+	ERROR_NULL_REFERENCE	= 1,	// NULL 참조
+	ERROR_OUT_OF_RANGE		= 2,	// 인덱스 바운더리 오류
+	ERROR_INVALID_ARGUMENT	= 3,	// 잘못된 매개변수
+	ERROR_OUT_OF_MEMORY		= 4,	// 메모리 할당 실패
+	ERROR_IO				= 5,	// 입출력 오류
+	ERROR_FORMAT			= 6,	// 문자열 또는 파일 형식 오류
+	ERROR_CHECKSUM			= 7,	// 체크섬 불일치
+	ERROR_READ_ONLY			= 8		// 읽기 전용 동적 배열 변경 시도
+};
+
+// 문자열 파서 상태 열거형 (dynamicIntArrayParser_t 참고)
+enum PARSE_STATE
+{
+	PARSE_STATE_ERROR		= -1,	// 형식 오류 발생 (더 이상 입력받지 않음)
+	PARSE_STATE_OPEN		= 0,	// 여는 중괄호 대기
+	PARSE_STATE_FIRST		= 1,	// 첫 번째 숫자 또는 닫는 중괄호 대기
+	PARSE_STATE_VALUE		= 2,	// 쉼표 다음 숫자 대기
+	PARSE_STATE_NUMBER		= 3,	// 숫자 변환 중
+	PARSE_STATE_SEPARATOR	= 4,	// 쉼표 또는 닫는 중괄호 대기
+	PARSE_STATE_CLOSED		= 5		// 닫는 중괄호 이후 (공백만 허용)
+};
+
+// 동적 배열 이진 파일 플래그 열거형 (dynamicIntArrayFileHeader_t 참고)
+enum FILE_FLAG
+{
+	FILE_FLAG_BIG_ENDIAN		= 0x01,	// 헤더와 원소가 빅 엔디안으로 저장됨
+	FILE_FLAG_BLOCK_CHECKSUM	= 0x02,	// 블록마다 뒤에 Adler-32 체크섬이 있음
+	FILE_FLAG_UNCHECKED			= 0x04	// 전체 체크섬을 관리하지 않음 (읽기/쓰기로 매핑한 파일)
+};
+
+// 동적 배열 저장소 종류 열거형
+enum STORAGE_KIND
+{
+	STORAGE_HEAP				= 0,	// malloc 으로 할당한 메모리
+	STORAGE_MAPPED_READ_ONLY	= 1,	// 읽기 전용으로 매핑한 파일 (dynamicIntArrayOpenMapped 참고)
+	STORAGE_MAPPED_READ_WRITE	= 2,	// 읽기/쓰기로 매핑한 파일 (dynamicIntArrayOpenMapped 참고)
+	STORAGE_SHARED_READ_ONLY	= 3,	// 읽기 전용으로 연결한 공유 메모리 (dynamicIntArrayAttachShared 참고)
+	STORAGE_SHARED_READ_WRITE	= 4,	// 읽기/쓰기로 생성하거나 연결한 공유 메모리 (dynamicIntArrayCreateShared 참고)
+	STORAGE_HUGE				= 5,	// 익명 매핑한 큰 배열 메모리 (dynamicIntArraySetHugeThreshold 참고)
+	STORAGE_ADOPTED				= 6		// 외부에서 넘겨받은 메모리 (dynamicIntArrayAdopt 참고)
+};
+
+// 파일 또는 공유 메모리 매핑 모드 열거형 (dynamicIntArrayOpenMapped, dynamicIntArrayAttachShared 참고)
+enum MAP_MODE
+{
+	MAP_MODE_READ_ONLY		= 0,	// 읽기 전용 (파일이 있어야 함)
+	MAP_MODE_READ_WRITE		= 1		// 읽기/쓰기 (파일이 없으면 생성)
+};
+
+// 조건 서술자 연산 열거형 (dynamicIntArrayPredicate_t 참고)
+enum PREDICATE_OP
+{
+	PREDICATE_OP_EQUAL			= 0,	// value == operand1
+	PREDICATE_OP_NOT_EQUAL		= 1,	// value != operand1
+	PREDICATE_OP_LESS			= 2,	// value < operand1
+	PREDICATE_OP_LESS_EQUAL		= 3,	// value <= operand1
+	PREDICATE_OP_GREATER		= 4,	// value > operand1
+	PREDICATE_OP_GREATER_EQUAL	= 5,	// value >= operand1
+	PREDICATE_OP_RANGE			= 6,	// operand1 <= value <= operand2
+	PREDICATE_OP_BITS_EQUAL		= 7,	// (value & operand1) == operand2
+	PREDICATE_OP_EVEN			= 8,	// value 가 짝수
+	PREDICATE_OP_ODD			= 9,	// value 가 홀수
+	PREDICATE_OP_AND			= 10,	// left 와 right 를 모두 만족
+	PREDICATE_OP_OR				= 11,	// left 와 right 중 하나 이상 만족
+	PREDICATE_OP_NOT			= 12	// left 를 만족하지 않음
+};
+
+// 형식화된 메시지를 전달받을 출력 sink 함수 포인터
+typedef void (*printSink_f)(int type, const char *text, void *context);
+
 // 조건 함수를 지정하기 위한 함수 포인터
 typedef int (*compareInt1Param_f)(int value);
 
+// 문맥(사용자 정의 데이터)을 함께 전달받는 조건 함수를 지정하기 위한 함수 포인터 (조건과 일치하면 YES, 아니면 NO 반환)
+typedef int (*compareIntWithContext_f)(int value, void *context);
+
+// 외부에서 넘겨받은 메모리를 해제하는 함수 포인터 (free 와 같은 형식, dynamicIntArrayAdopt 참고)
+typedef void (*dynamicIntArrayFree_f)(void *pointer);
+
+// 동적 배열이 사용하는 메모리 할당자 구조체 (함수 테이블과 사용자 정의 데이터)
+// 해제와 재할당 함수는 할당할 때 요청한 크기를 함께 전달받으므로 할당자가 크기를 따로 기록하지 않아도 된다.
+typedef struct dynamicIntArrayAllocator_s dynamicIntArrayAllocator_t;
+struct dynamicIntArrayAllocator_s
+{
+	// size 바이트를 할당하는 함수 (초기화하지 않음, 실패 시 NULL 반환)
+	void *(*allocate)(void *context, size_t size);
+	// oldSize 바이트로 할당한 메모리를 newSize 바이트로 재할당하는 함수 (pointer 가 NULL 이면 할당, 실패 시 NULL 반환하고 기존 메모리 유지)
+	void *(*reallocate)(void *context, void *pointer, size_t oldSize, size_t newSize);
+	// size 바이트로 할당한 메모리를 해제하는 함수
+	void (*deallocate)(void *context, void *pointer, size_t size);
+	// 함수들에 전달할 사용자 정의 데이터
+	void *context;
+};
+
+// 아레나 할당자의 메모리 블록 (dynamicIntArray.c 에서 정의)
+typedef struct dynamicIntArrayArenaBlock_s dynamicIntArrayArenaBlock_t;
+
+// 블록 안에서 포인터만 증가시키며 할당하고 dynamicIntArrayArenaReset 으로 한 번에 해제하는 아레나 할당자 구조체
+// allocator 의 context 가 구조체 자신을 가리키므로 초기화한 뒤에는 복사하거나 옮기면 안 된다.
+typedef struct dynamicIntArrayArena_s dynamicIntArrayArena_t;
+struct dynamicIntArrayArena_s
+{
+	// 동적 배열 생성 시 지정할 할당자
+	dynamicIntArrayAllocator_t allocator;
+	// 할당에 사용 중인 블록 (이전 블록들은 next 로 연결)
+	dynamicIntArrayArenaBlock_t *blocks;
+	// 새 블록의 기본 크기 (바이트)
+	size_t blockSize;
+};
+
+// 풀 할당자의 slab 과 큰 메모리 블록 (dynamicIntArray.c 에서 정의)
+typedef struct dynamicIntArrayPoolSlab_s dynamicIntArrayPoolSlab_t;
+typedef struct dynamicIntArrayPoolLarge_s dynamicIntArrayPoolLarge_t;
+
+// 2 의 거듭제곱 크기 등급별 free list 로 조각을 재사용하고 dynamicIntArrayPoolReset 으로 한 번에 해제하는 풀 할당자 구조체
+// 가장 큰 크기 등급보다 큰 메모리는 따로 할당해서 목록으로 관리한다.
+// allocator 의 context 가 구조체 자신을 가리키므로 초기화한 뒤에는 복사하거나 옮기면 안 된다.
+typedef struct dynamicIntArrayPool_s dynamicIntArrayPool_t;
+struct dynamicIntArrayPool_s
+{
+	// 동적 배열 생성 시 지정할 할당자
+	dynamicIntArrayAllocator_t allocator;
+	// 크기 등급별로 해제된 조각 목록 (조각의 첫 8 바이트에 다음 조각 주소를 저장)
+	void *freeLists[DYNAMIC_INT_ARRAY_POOL_CLASS_COUNT];
+	// 조각을 잘라 쓰고 있는 slab (이전 slab 들은 next 로 연결)
+	dynamicIntArrayPoolSlab_t *slabs;
+	// 가장 큰 크기 등급보다 커서 따로 할당한 메모리 목록
+	dynamicIntArrayPoolLarge_t *larges;
+};
+
+// 기본 할당자의 쓰레드별 재사용 캐시 통계 구조체 (dynamicIntArrayGetRecycleStats 참고)
+typedef struct dynamicIntArrayRecycleStats_s dynamicIntArrayRecycleStats_t;
+struct dynamicIntArrayRecycleStats_s
+{
+	// 캐시에서 꺼내서 할당한 횟수
+	size_t hits;
+	// 캐시가 비어 있어서 malloc 으로 할당한 횟수
+	size_t misses;
+	// 해제할 때 캐시에 보관한 횟수
+	size_t recycled;
+	// 해제할 때 캐시가 가득 차서 free 로 해제한 횟수
+	size_t released;
+	// 캐시에 보관 중인 관리 구조체 개수
+	size_t cachedHeaders;
+	// 캐시에 보관 중인 원소 메모리 개수
+	size_t cachedBuffers;
+	// 캐시에 보관 중인 전체 크기 (바이트)
+	size_t cachedBytes;
+};
+
+// copy-on-write 복제본들이 함께 사용하는 원소 저장소의 참조 횟수 블록 (dynamicIntArray.c 에서 정의, dynamicIntArrayCloneCow 참고)
+typedef struct dynamicIntArrayCowBlock_s dynamicIntArrayCowBlock_t;
+
 // int 형 동적 배열을 관리하는 구조체
 typedef struct dynamicIntArray_s dynamicIntArray_t;
 struct dynamicIntArray_s
 {
-	// 동적 배열 전체 크기
-	int size;
+	// 동적 배열 전체 크기 (저장된 원소 개수)
+	size_t size;
+	// 동적 배열에 할당된 용량 (재할당 없이 저장할 수 있는 원소 개수)
+	size_t capacity;
+	// 예약된 용량 (용량 축소 시 이 값보다 작게 줄이지 않음)
+	size_t reservedCapacity;
+	// 용량 증가 배율 (백분율)
+	int growthFactor;
+	// 용량 최소 증가량 (원소 개수)
+	int growthMinIncrement;
+	// 용량 최대 여유 공간 (원소 개수, 0 이면 제한 없음)
+	int growthMaxSlack;
 	// 동적 배열의 주소
 	int *data;
 	// 동적 배열의 모든 원소를 담고 있는 문자열의 주소
 	char *stringOfArray;
+	// 문자열을 할당한 크기 (바이트, 널 문자 포함, 할당자의 reallocate/deallocate 에 전달)
+	size_t stringCapacity;
+	// 동적 배열 저장소 종류 (STORAGE_KIND 열거형 참고)
+	int storageKind;
+	// 매핑 저장소의 파일 디스크립터 (힙 저장소는 -1)
+	int storageFd;
+	// 매핑 저장소의 매핑 시작 주소 (헤더 포함, 힙 저장소는 NULL)
+	void *storageBase;
+	// 매핑 저장소의 매핑 길이 (바이트)
+	size_t storageLength;
+	// 공유 메모리 저장소에서 마지막으로 확인한 헤더의 세대 번호 (dynamicIntArrayRefresh 참고)
+	uint64_t storageGeneration;
+	// 외부에서 넘겨받은 메모리를 해제하는 함수 (NULL 이면 해제하지 않음, dynamicIntArrayAdopt 참고)
+	dynamicIntArrayFree_f adoptedFree;
+	// 원소 저장소를 다른 복제본과 함께 사용 중이면 참조 횟수 블록 (혼자 사용하면 NULL, dynamicIntArrayCloneCow 참고)
+	dynamicIntArrayCowBlock_t *cowBlock;
+	// 구조체와 동적 배열, 문자열을 할당한 메모리 할당자
+	const dynamicIntArrayAllocator_t *allocator;
+	// 용량이 DYNAMIC_INT_ARRAY_INLINE_CAPACITY 이하인 힙 저장소 동적 배열의 원소를 저장하는 인라인 저장소
+	// (data 가 이 배열을 가리킬 수 있으므로 초기화한 구조체를 값으로 복사하거나 옮기면 안 됨)
+	int inlineData[(DYNAMIC_INT_ARRAY_INLINE_CAPACITY > 0) ? DYNAMIC_INT_ARRAY_INLINE_CAPACITY : 1];
+};
+
+// 동적 배열의 일부 구간이나 외부 메모리를 복사하지 않고 가리키는 뷰 구조체 (원소 저장소를 소유하지 않음)
+// 값으로 복사해서 사용할 수 있고 해제할 필요가 없다.
+// 가리키는 동적 배열의 용량이 바뀌거나(재할당) 해제되면 더 이상 사용할 수 없다.
+typedef struct dynamicIntArrayView_s dynamicIntArrayView_t;
+struct dynamicIntArrayView_s
+{
+	// 뷰의 첫 번째 원소 주소 (length 가 0 이면 NULL 일 수 있음)
+	int *data;
+	// 뷰의 원소 개수
+	size_t length;
+	// 이웃한 원소 사이의 간격 (원소 개수, 1 이면 연속된 구간)
+	size_t stride;
+	// 뷰를 통한 변경 금지 여부 (YES 또는 NO)
+	int isReadOnly;
+};
+
+// 조건 함수 대신 사용하는 선언적 조건 서술자 구조체 (비교 연산과 결합 연산으로 이루어진 트리)
+// dynamicIntArrayPredicateCompile 로 컴파일한 뒤 SIMD 커널로 평가한다.
+typedef struct dynamicIntArrayPredicate_s dynamicIntArrayPredicate_t;
+struct dynamicIntArrayPredicate_s
+{
+	// 연산 (PREDICATE_OP 열거형 참고)
+	int op;
+	// 첫 번째 피연산자 (비교 연산에서 사용)
+	int operand1;
+	// 두 번째 피연산자 (PREDICATE_OP_RANGE, PREDICATE_OP_BITS_EQUAL 에서 사용)
+	int operand2;
+	// 첫 번째 하위 조건 (PREDICATE_OP_AND, PREDICATE_OP_OR, PREDICATE_OP_NOT 에서 사용)
+	const dynamicIntArrayPredicate_t *left;
+	// 두 번째 하위 조건 (PREDICATE_OP_AND, PREDICATE_OP_OR 에서 사용)
+	const dynamicIntArrayPredicate_t *right;
+};
+
+// 컴파일된 조건 서술자의 한 단계 구조체 (SIMD_PREDICATE_STEP 열거형 참고)
+typedef struct dynamicIntArrayPredicateStep_s dynamicIntArrayPredicateStep_t;
+struct dynamicIntArrayPredicateStep_s
+{
+	// 단계 종류
+	int kind;
+	// 첫 번째 피연산자
+	int operand1;
+	// 두 번째 피연산자
+	int operand2;
+};
+
+// 컴파일된 조건 서술자 구조체 (후위 표기법 단계 목록, dynamicIntArrayPredicateCompile 로만 생성)
+// SIMD 커널은 원소 블록마다 단계들을 차례로 평가해서 원소별 일치 여부 비트 마스크를 만든다.
+typedef struct dynamicIntArrayPredicateProgram_s dynamicIntArrayPredicateProgram_t;
+struct dynamicIntArrayPredicateProgram_s
+{
+	// 단계 개수
+	size_t stepCount;
+	// 단계 목록
+	dynamicIntArrayPredicateStep_t steps[DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS];
+};
+
+// "{ 1, 2, 3 }" 형식의 문자열을 여러 조각으로 나누어 전달받아 동적 배열로 변환하는 파서 구조체
+typedef struct dynamicIntArrayParser_s dynamicIntArrayParser_t;
+struct dynamicIntArrayParser_s
+{
+	// 변환 중인 동적 배열 (첫 번째 조각을 전달받을 때 생성)
+	dynamicIntArray_t *array;
+	// 파서 상태 (PARSE_STATE 열거형 참고)
+	int state;
+	// 변환 중인 숫자가 음수인지 여부 (YES 또는 NO)
+	int isNegative;
+	// 변환 중인 숫자의 자리수
+	int digitCount;
+	// 변환 중인 숫자의 절댓값
+	unsigned long long value;
+	// 지금까지 전달받은 문자열 길이 (오류 위치 출력용)
+	size_t offset;
+};
+
+// 동적 배열 이진 파일 헤더 구조체 (32 바이트, 모든 필드는 flags 가 나타내는 바이트 순서로 저장)
+// 헤더 다음에 원소들이 DYNAMIC_INT_ARRAY_FILE_BLOCK_SIZE 개씩 이어지고,
+// FILE_FLAG_BLOCK_CHECKSUM 이 있으면 블록마다 뒤에 4 바이트 Adler-32 체크섬이 붙는다.
+typedef struct dynamicIntArrayFileHeader_s dynamicIntArrayFileHeader_t;
+struct dynamicIntArrayFileHeader_s
+{
+	// 파일 식별자 (DYNAMIC_INT_ARRAY_FILE_MAGIC)
+	char magic[4];
+	// 파일 형식 버전
+	uint16_t version;
+	// 원소 하나의 크기 (바이트)
+	uint8_t elementWidth;
+	// 파일 플래그 (FILE_FLAG 열거형 참고)
+	uint8_t flags;
+	// 블록 하나의 원소 개수
+	uint32_t blockSize;
+	// 예약됨 (0)
+	uint32_t reserved;
+	// 원소 개수
+	uint64_t count;
+	// 모든 원소의 Adler-32 체크섬
+	uint32_t checksum;
+	// headerChecksum 앞까지 헤더의 Adler-32 체크섬
+	uint32_t headerChecksum;
+};
+
+// 공유 메모리 동적 배열 헤더 구조체 (64 바이트, 원소들이 캐시 라인 경계에서 시작하도록 채움)
+// size, capacity, generation 은 여러 프로세스가 동시에 접근하므로 원자적으로 읽고 쓴다.
+// 쓰는 쪽은 원소를 변경한 후 size 와 capacity 를 쓰고 generation 을 증가시키며(release),
+// 읽는 쪽은 generation 이 바뀌었으면(acquire) 다시 매핑해서 크기 변경을 반영한다.
+typedef struct dynamicIntArraySharedHeader_s dynamicIntArraySharedHeader_t;
+struct dynamicIntArraySharedHeader_s
+{
+	// 공유 메모리 식별자 (DYNAMIC_INT_ARRAY_SHARED_MAGIC)
+	char magic[4];
+	// 헤더 형식 버전
+	uint16_t version;
+	// 원소 하나의 크기 (바이트)
+	uint8_t elementWidth;
+	// 예약됨 (0)
+	uint8_t reserved;
+	// 원소 개수
+	uint64_t size;
+	// 공유 메모리에 할당된 용량 (원소 개수, 줄어들지 않음)
+	uint64_t capacity;
+	// 크기나 용량을 게시할 때마다 1 씩 증가하는 세대 번호
+	uint64_t generation;
+	// 캐시 라인 크기까지 채움 (0)
+	uint8_t padding[32];
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -55,40 +459,226 @@ struct dynamicIntArray_s
 ///////////////////////////////////////////////////////////////////////////////////////
 
 dynamicIntArray_t *dynamicIntArrayNew(int size);
+dynamicIntArray_t *dynamicIntArrayNewWithCapacity(int capacity);
+dynamicIntArray_t *dynamicIntArrayNewWithAllocator(int capacity, const dynamicIntArrayAllocator_t *allocator);
 int dynamicIntArrayInitialize(dynamicIntArray_t *array, int size);
 dynamicIntArray_t *dynamicIntArrayResize(dynamicIntArray_t *array, int size, int isKeep);
+int dynamicIntArrayReserve(dynamicIntArray_t *array, int capacity);
+int dynamicIntArrayShrinkToFit(dynamicIntArray_t *array);
+int dynamicIntArraySetGrowthPolicy(dynamicIntArray_t *array, int factor, int minIncrement, int maxSlack);
+void dynamicIntArraySetHugeThreshold(size_t bytes);
+size_t dynamicIntArrayGetHugeThreshold(void);
+int dynamicIntArraySetDefaultAllocator(const dynamicIntArrayAllocator_t *allocator);
+const dynamicIntArrayAllocator_t *dynamicIntArrayGetDefaultAllocator(void);
+const dynamicIntArrayAllocator_t *dynamicIntArrayGetAllocator(const dynamicIntArray_t *array);
+void dynamicIntArraySetRecycleLimit(size_t count);
+size_t dynamicIntArrayGetRecycleLimit(void);
+int dynamicIntArrayGetRecycleStats(dynamicIntArrayRecycleStats_t *stats);
+size_t dynamicIntArrayTrimRecycle(void);
 int dynamicIntArrayClear(dynamicIntArray_t *array);
 int dynamicIntArrayFinal(dynamicIntArray_t *array);
 void dynamicIntArrayDelete(dynamicIntArray_t **array);
 
-int dynamicIntArraySetElement(const dynamicIntArray_t *array, int index, int datum);
+int dynamicIntArraySetElement(dynamicIntArray_t *array, int index, int datum);
 int dynamicIntArrayGetElement(const dynamicIntArray_t *array, int index, int *isError);
 
 dynamicIntArray_t *dynamicIntArrayAppend(dynamicIntArray_t *array, int datum);
+dynamicIntArray_t *dynamicIntArrayAppendN(dynamicIntArray_t *array, const int *src, int n);
+dynamicIntArray_t *dynamicIntArrayAppendArray(dynamicIntArray_t *dst, const dynamicIntArray_t *src);
 dynamicIntArray_t *dynamicIntArrayInsertAt(dynamicIntArray_t *array, int index, int datum);
+dynamicIntArray_t *dynamicIntArrayInsertRange(dynamicIntArray_t *array, int index, const int *src, int n);
 dynamicIntArray_t *dynamicIntArrayRemoveAt(dynamicIntArray_t *array, int index);
+dynamicIntArray_t *dynamicIntArrayRemoveRange(dynamicIntArray_t *array, int index, int n);
 
 int dynamicIntArrayIndexOf(const dynamicIntArray_t *array, int datum);
 int dynamicIntArrayLastIndexOf(const dynamicIntArray_t *array, int datum);
+int dynamicIntArrayCount(const dynamicIntArray_t *array, int datum);
 int dynamicIntArrayFind(const dynamicIntArray_t *array, compareInt1Param_f func);
+size_t dynamicIntArrayFindIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context);
+size_t dynamicIntArrayFindLastIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context);
+size_t dynamicIntArrayFindAllIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context, size_t *indices, size_t capacity);
+size_t dynamicIntArrayCountIf(const dynamicIntArray_t *array, compareIntWithContext_f func, void *context);
+size_t dynamicIntArrayRemoveIf(dynamicIntArray_t *array, compareIntWithContext_f func, void *context);
+size_t dynamicIntArrayPartition(dynamicIntArray_t *array, compareIntWithContext_f func, void *context);
+int dynamicIntArrayPredicateCompile(const dynamicIntArrayPredicate_t *predicate, dynamicIntArrayPredicateProgram_t *program);
+size_t dynamicIntArrayFindWhere(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program);
+size_t dynamicIntArrayCountWhere(const dynamicIntArray_t *array, const dynamicIntArrayPredicateProgram_t *program);
+size_t dynamicIntArrayFilterWhere(const dynamicIntArray_t *src, const dynamicIntArrayPredicateProgram_t *program, dynamicIntArray_t *dst);
+int dynamicIntArraySum(const dynamicIntArray_t *array, int64_t *sum);
+int dynamicIntArrayMin(const dynamicIntArray_t *array, int *min);
+int dynamicIntArrayMax(const dynamicIntArray_t *array, int *max);
+int dynamicIntArrayMinMax(const dynamicIntArray_t *array, int *min, int *max);
+size_t dynamicIntArrayArgMin(const dynamicIntArray_t *array);
+size_t dynamicIntArrayArgMax(const dynamicIntArray_t *array);
+int dynamicIntArrayMean(const dynamicIntArray_t *array, double *mean);
 
-int dynamicIntArrayCopy(const dynamicIntArray_t *dst, int dstIndex, const dynamicIntArray_t *src, int srcIndex, int size);
+int dynamicIntArrayCopy(dynamicIntArray_t *dst, int dstIndex, const dynamicIntArray_t *src, int srcIndex, int size);
 dynamicIntArray_t *dynamicIntArrayClone(const dynamicIntArray_t *original);
+dynamicIntArray_t *dynamicIntArrayCloneCow(dynamicIntArray_t *original);
+int dynamicIntArrayDetach(dynamicIntArray_t *array);
+size_t dynamicIntArrayGetShareCount(const dynamicIntArray_t *array);
+int dynamicIntArraySwap(dynamicIntArray_t *a, dynamicIntArray_t *b);
+int dynamicIntArrayMove(dynamicIntArray_t *dst, dynamicIntArray_t *src);
+int dynamicIntArrayAdopt(dynamicIntArray_t *array, int *buffer, int size, int capacity, dynamicIntArrayFree_f freeFunc);
+int *dynamicIntArrayRelease(dynamicIntArray_t *array, int *size);
 
-int dynamicIntArrayReverse(const dynamicIntArray_t *array);
-int dynamicIntArrayFill(const dynamicIntArray_t *array, int datum);
+int dynamicIntArrayReverse(dynamicIntArray_t *array);
+int dynamicIntArrayReverseRange(dynamicIntArray_t *array, int from, int n);
+int dynamicIntArrayRotate(dynamicIntArray_t *array, int k);
+int dynamicIntArrayFill(dynamicIntArray_t *array, int datum);
+int dynamicIntArrayFillRange(dynamicIntArray_t *array, int from, int n, int datum);
 int *dynamicIntArrayGetArrayPtr(const dynamicIntArray_t *array);
 int dynamicIntArrayCheckBoundary(const dynamicIntArray_t *array, int index);
 char *dynamicIntArrayToString(dynamicIntArray_t *array);
+ssize_t dynamicIntArrayFormatTo(const dynamicIntArray_t *array, char *buf, size_t cap);
+ssize_t dynamicIntArrayWriteTo(const dynamicIntArray_t *array, int fd);
+ssize_t dynamicIntArrayWriteToFile(const dynamicIntArray_t *array, FILE *stream);
+dynamicIntArray_t *dynamicIntArrayFromString(const char *string);
+dynamicIntArray_t *dynamicIntArrayParseBuffer(const char *buffer, size_t length);
+int dynamicIntArraySave(const dynamicIntArray_t *array, int fd, int isBlockChecksum);
+dynamicIntArray_t *dynamicIntArrayLoad(int fd);
+dynamicIntArray_t *dynamicIntArrayOpenMapped(const char *path, int mode);
+int dynamicIntArraySync(dynamicIntArray_t *array);
+dynamicIntArray_t *dynamicIntArrayCreateShared(const char *name, int capacity);
+dynamicIntArray_t *dynamicIntArrayAttachShared(const char *name, int mode);
+dynamicIntArray_t *dynamicIntArrayAttachSharedFd(int fd, int mode);
+int dynamicIntArrayRefresh(dynamicIntArray_t *array);
+int dynamicIntArrayGetSharedFd(const dynamicIntArray_t *array);
+int dynamicIntArrayUnlinkShared(const char *name);
 
 int dynamicIntArrayGetSize(const dynamicIntArray_t *array);
+int dynamicIntArrayGetCapacity(const dynamicIntArray_t *array);
+
+// 크기와 인덱스를 size_t 로 다루는 함수들 (원소가 2^31 개 이상인 동적 배열도 사용 가능)
+dynamicIntArray_t *dynamicIntArrayNew64(size_t size);
+dynamicIntArray_t *dynamicIntArrayResize64(dynamicIntArray_t *array, size_t size, int isKeep);
+int dynamicIntArraySetElement64(dynamicIntArray_t *array, size_t index, int datum);
+int dynamicIntArrayGetElement64(const dynamicIntArray_t *array, size_t index, int *isError);
+size_t dynamicIntArrayIndexOf64(const dynamicIntArray_t *array, int datum);
+size_t dynamicIntArrayLastIndexOf64(const dynamicIntArray_t *array, int datum);
+size_t dynamicIntArrayCount64(const dynamicIntArray_t *array, int datum);
+size_t dynamicIntArrayFind64(const dynamicIntArray_t *array, compareInt1Param_f func);
+int dynamicIntArrayCopy64(dynamicIntArray_t *dst, size_t dstIndex, const dynamicIntArray_t *src, size_t srcIndex, size_t size);
+int dynamicIntArrayCheckBoundary64(const dynamicIntArray_t *array, size_t index);
+size_t dynamicIntArrayGetSize64(const dynamicIntArray_t *array);
+size_t dynamicIntArrayGetCapacity64(const dynamicIntArray_t *array);
+int dynamicIntArrayAdopt64(dynamicIntArray_t *array, int *buffer, size_t size, size_t capacity, dynamicIntArrayFree_f freeFunc);
+int *dynamicIntArrayRelease64(dynamicIntArray_t *array, size_t *size);
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for dynamicIntArrayView_t
+///////////////////////////////////////////////////////////////////////////////////////
+
+int dynamicIntArrayViewOf(const dynamicIntArray_t *array, size_t from, size_t length, dynamicIntArrayView_t *view);
+int dynamicIntArrayViewOfMutable(dynamicIntArray_t *array, size_t from, size_t length, dynamicIntArrayView_t *view);
+int dynamicIntArrayViewFromBuffer(int *data, size_t length, size_t stride, int isReadOnly, dynamicIntArrayView_t *view);
+int dynamicIntArrayViewSlice(const dynamicIntArrayView_t *view, size_t from, size_t length, size_t step, dynamicIntArrayView_t *slice);
+int dynamicIntArrayViewGetElement(const dynamicIntArrayView_t *view, size_t index, int *isError);
+
+size_t dynamicIntArrayViewIndexOf(const dynamicIntArrayView_t *view, int datum);
+size_t dynamicIntArrayViewLastIndexOf(const dynamicIntArrayView_t *view, int datum);
+size_t dynamicIntArrayViewCount(const dynamicIntArrayView_t *view, int datum);
+size_t dynamicIntArrayViewFind(const dynamicIntArrayView_t *view, compareInt1Param_f func);
+
+int dynamicIntArrayViewReverse(const dynamicIntArrayView_t *view);
+int dynamicIntArrayViewFill(const dynamicIntArrayView_t *view, int datum);
+
+int dynamicIntArrayViewSum(const dynamicIntArrayView_t *view, int64_t *sum);
+int dynamicIntArrayViewMin(const dynamicIntArrayView_t *view, int *min);
+int dynamicIntArrayViewMax(const dynamicIntArrayView_t *view, int *max);
+int dynamicIntArrayViewMinMax(const dynamicIntArrayView_t *view, int *min, int *max);
+size_t dynamicIntArrayViewArgMin(const dynamicIntArrayView_t *view);
+size_t dynamicIntArrayViewArgMax(const dynamicIntArrayView_t *view);
+int dynamicIntArrayViewMean(const dynamicIntArrayView_t *view, double *mean);
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for dynamicIntArrayParser_t
+///////////////////////////////////////////////////////////////////////////////////////
+
+int dynamicIntArrayParserInitialize(dynamicIntArrayParser_t *parser);
+int dynamicIntArrayParserFeed(dynamicIntArrayParser_t *parser, const char *text, size_t length);
+dynamicIntArray_t *dynamicIntArrayParserFinish(dynamicIntArrayParser_t *parser);
+int dynamicIntArrayParserFinal(dynamicIntArrayParser_t *parser);
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for dynamicIntArrayArena_t, dynamicIntArrayPool_t
+///////////////////////////////////////////////////////////////////////////////////////
+
+int dynamicIntArrayArenaInitialize(dynamicIntArrayArena_t *arena, size_t blockSize);
+void dynamicIntArrayArenaReset(dynamicIntArrayArena_t *arena);
+int dynamicIntArrayArenaFinal(dynamicIntArrayArena_t *arena);
+
+int dynamicIntArrayPoolInitialize(dynamicIntArrayPool_t *pool);
+void dynamicIntArrayPoolReset(dynamicIntArrayPool_t *pool);
+int dynamicIntArrayPoolFinal(dynamicIntArrayPool_t *pool);
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Inline Functions for dynamicIntArray_t
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static inline int dynamicIntArrayGetUnchecked(const dynamicIntArray_t *array, int index)
+ * @brief 동적 배열의 지정한 인덱스에 저장된 값을 검사 없이 반환하는 함수
+ * NULL 과 인덱스 바운더리를 검사하지 않으므로 호출자가 유효한 인덱스를 보장해야 한다.
+ * DYNAMIC_INT_ARRAY_CHECK_UNCHECKED_ACCESS 가 1 이면 assert 로 검사한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력, 읽기 전용)
+ * @param index 지정할 인덱스(입력)
+ * @return 지정한 인덱스에 저장된 값 반환
+ */
+static inline int dynamicIntArrayGetUnchecked(const dynamicIntArray_t *array, int index)
+{
+#if DYNAMIC_INT_ARRAY_CHECK_UNCHECKED_ACCESS
+	assert((array != NULL) && (index >= 0) && ((size_t)index < array->size));
+#endif
+	return array->data[index];
+}
+
+/**
+ * @fn static inline void dynamicIntArraySetUnchecked(dynamicIntArray_t *array, int index, int datum)
+ * @brief 동적 배열의 지정한 인덱스에 특정 값을 검사 없이 저장하는 함수
+ * NULL 과 인덱스 바운더리, 읽기 전용 저장소 여부를 검사하지 않으므로 호출자가 보장해야 한다.
+ * copy-on-write 복제본과 원소 저장소를 함께 사용 중이면 분리하지 않으므로, 먼저 dynamicIntArrayDetach 를 호출해야 한다.
+ * DYNAMIC_INT_ARRAY_CHECK_UNCHECKED_ACCESS 가 1 이면 assert 로 검사한다.
+ * @param array 동적 배열 관리 구조체 포인터(입력)
+ * @param index 지정할 인덱스(입력)
+ * @param datum 저장할 특정 값(입력)
+ * @return 반환값 없음
+ */
+static inline void dynamicIntArraySetUnchecked(dynamicIntArray_t *array, int index, int datum)
+{
+#if DYNAMIC_INT_ARRAY_CHECK_UNCHECKED_ACCESS
+	assert((array != NULL) && (index >= 0) && ((size_t)index < array->size) && (array->storageKind != STORAGE_MAPPED_READ_ONLY) && (array->storageKind != STORAGE_SHARED_READ_ONLY) && (array->cowBlock == NULL));
+#endif
+	array->data[index] = datum;
+}
 
 ///////////////////////////////////////////////////////////////////////////////////////
 /// Common Util Functions
 ///////////////////////////////////////////////////////////////////////////////////////
 
 void printMsg(const char *msg, int type, int argc, ...);
+void printSetLevel(int level);
+int printGetLevel(void);
+void printSetSink(printSink_f sink, void *context);
+void printSetBuffered(int isBuffered);
+void printFlush(void);
 int checkObjectNull(const void *object, const char *msg);
 
+int dynamicIntArrayGetLastError(void);
+void dynamicIntArraySetLastError(int errorCode);
+void dynamicIntArrayClearLastError(void);
+const char *dynamicIntArrayGetErrorString(int errorCode);
+
+/**
+ * @fn static inline int printIsEnabled(int type)
+ * @brief 지정한 출력 형태의 메시지가 현재 출력 수준에서 출력되는지 확인하는 함수
+ * @param type 출력 형태(입력, PRINT_TYPE 열거형 참고)
+ * @return 출력되면 YES, 아니면 NO 반환
+ */
+static inline int printIsEnabled(int type)
+{
+	return (type <= printGetLevel()) ? YES : NO;
+}
+
 #endif // #ifndef __DYANMIC_INT_ARRAY_H__
 
@@ -0,0 +1,1800 @@
+#include "dynamicIntArray.h"
+#include "dynamicIntArraySimd.h"
+
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_IS_X86	1
+#include <immintrin.h>
+#else
+#define SIMD_IS_X86	0
+#endif
+
+// 개수 세기 커널에서 32 비트 레인 누적값이 넘치지 않도록 한 번에 처리하는 최대 원소 개수
+#define SIMD_COUNT_BLOCK	((size_t)1 << 24)
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Predefinitions of Static Functions
+///////////////////////////////////////////////////////////////////////////////////////
+
+static int simdDetectLevel(void);
+static void simdInitialize(void) __attribute__((constructor));
+static void simdBuildCompressTable(void);
+
+static size_t scalarIndexOf(const int *data, size_t n, int datum);
+static size_t scalarLastIndexOf(const int *data, size_t n, int datum);
+static size_t scalarCount(const int *data, size_t n, int datum);
+static void scalarFill(int *data, size_t n, int datum, int isStreaming);
+static void scalarReverse(int *data, size_t n);
+static size_t scalarCountByte(const char *data, size_t n, char byte);
+static int scalarPredicateMatch(int value, const dynamicIntArrayPredicateProgram_t *program);
+static size_t scalarFindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t scalarCountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t scalarFilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out);
+static int64_t scalarSum(const int *data, size_t n);
+static void scalarMinMax(const int *data, size_t n, int *min, int *max);
+
+#if SIMD_IS_X86
+static size_t sse2IndexOf(const int *data, size_t n, int datum);
+static size_t sse2LastIndexOf(const int *data, size_t n, int datum);
+static size_t sse2Count(const int *data, size_t n, int datum);
+static void sse2Fill(int *data, size_t n, int datum, int isStreaming);
+static void sse2Reverse(int *data, size_t n);
+static size_t sse2CountByte(const char *data, size_t n, char byte);
+static size_t sse2FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t sse2CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t sse2FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out);
+static int64_t sse2Sum(const int *data, size_t n);
+static void sse2MinMax(const int *data, size_t n, int *min, int *max);
+static size_t avx2IndexOf(const int *data, size_t n, int datum);
+static size_t avx2LastIndexOf(const int *data, size_t n, int datum);
+static size_t avx2Count(const int *data, size_t n, int datum);
+static void avx2Fill(int *data, size_t n, int datum, int isStreaming);
+static void avx2Reverse(int *data, size_t n);
+static size_t avx2CountByte(const char *data, size_t n, char byte);
+static size_t avx2FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t avx2CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t avx2FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out);
+static int64_t avx2Sum(const int *data, size_t n);
+static void avx2MinMax(const int *data, size_t n, int *min, int *max);
+static size_t avx512IndexOf(const int *data, size_t n, int datum);
+static size_t avx512LastIndexOf(const int *data, size_t n, int datum);
+static size_t avx512Count(const int *data, size_t n, int datum);
+static void avx512Fill(int *data, size_t n, int datum, int isStreaming);
+static void avx512Reverse(int *data, size_t n);
+static size_t avx512FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t avx512CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program);
+static size_t avx512FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out);
+static int64_t avx512Sum(const int *data, size_t n);
+static void avx512MinMax(const int *data, size_t n, int *min, int *max);
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Variables
+///////////////////////////////////////////////////////////////////////////////////////
+
+// 커널 테이블 (simdInitialize 가 실행되기 전에도 사용할 수 있도록 스칼라 커널로 초기화)
+simdKernels_t simdKernels =
+{
+	SIMD_LEVEL_SCALAR,
+	scalarIndexOf,
+	scalarLastIndexOf,
+	scalarCount,
+	scalarFill,
+	scalarReverse,
+	scalarCountByte,
+	scalarFindWhere,
+	scalarCountWhere,
+	scalarFilterWhere,
+	scalarSum,
+	scalarMinMax
+};
+
+// streaming store 를 사용하기 시작하는 채우기 크기 (바이트, simdInitialize 에서 마지막 단계 캐시 크기로 설정)
+static size_t simdStreamingThreshold = SIMD_DEFAULT_STREAMING_THRESHOLD;
+
+// AVX2 필터 커널의 레인 재배치 표 (8 비트 일치 마스크마다 일치하는 레인 번호를 앞에서부터 나열, simdInitialize 에서 생성)
+static uint8_t simdCompressTable[256][8];
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for SIMD kernels
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int simdSetLevel(int level)
+ * @brief 사용할 SIMD 명령어 수준을 지정하고 그에 맞는 커널들을 선택하는 함수
+ * CPU 가 지원하는 수준보다 높게 지정하면 지원하는 가장 높은 수준이 선택된다.
+ * 커널 테이블은 쓰레드 간에 공유되므로 쓰레드들이 동작하기 전에 호출해야 한다.
+ * @param level 사용할 SIMD 명령어 수준(입력, SIMD_LEVEL 열거형 참고)
+ * @return 성공 시 SUCCESS, 실패 시 FAIL 반환
+ */
+int simdSetLevel(int level)
+{
+	if((level < SIMD_LEVEL_SCALAR) || (level > SIMD_LEVEL_AVX512))
+	{
+		PRINT_MSG("알 수 없는 SIMD 명령어 수준. (simdSetLevel, level:%d)", ERROR, 1, level);
+		dynamicIntArraySetLastError(ERROR_INVALID_ARGUMENT);
+		return FAIL;
+	}
+
+	int detectedLevel = simdDetectLevel();
+	if(level > detectedLevel)
+	{
+		level = detectedLevel;
+	}
+
+	simdKernels_t kernels = { SIMD_LEVEL_SCALAR, scalarIndexOf, scalarLastIndexOf, scalarCount, scalarFill, scalarReverse, scalarCountByte,
+		scalarFindWhere, scalarCountWhere, scalarFilterWhere, scalarSum, scalarMinMax };
+
+#if SIMD_IS_X86
+	if(level == SIMD_LEVEL_AVX512)
+	{
+		kernels.indexOf = avx512IndexOf;
+		kernels.lastIndexOf = avx512LastIndexOf;
+		kernels.count = avx512Count;
+		kernels.fill = avx512Fill;
+		kernels.reverse = avx512Reverse;
+		kernels.countByte = avx2CountByte;
+		kernels.findWhere = avx512FindWhere;
+		kernels.countWhere = avx512CountWhere;
+		kernels.filterWhere = avx512FilterWhere;
+		kernels.sum = avx512Sum;
+		kernels.minMax = avx512MinMax;
+	}
+	else if(level == SIMD_LEVEL_AVX2)
+	{
+		kernels.indexOf = avx2IndexOf;
+		kernels.lastIndexOf = avx2LastIndexOf;
+		kernels.count = avx2Count;
+		kernels.fill = avx2Fill;
+		kernels.reverse = avx2Reverse;
+		kernels.countByte = avx2CountByte;
+		kernels.findWhere = avx2FindWhere;
+		kernels.countWhere = avx2CountWhere;
+		kernels.filterWhere = avx2FilterWhere;
+		kernels.sum = avx2Sum;
+		kernels.minMax = avx2MinMax;
+	}
+	else if(level == SIMD_LEVEL_SSE2)
+	{
+		kernels.indexOf = sse2IndexOf;
+		kernels.lastIndexOf = sse2LastIndexOf;
+		kernels.count = sse2Count;
+		kernels.fill = sse2Fill;
+		kernels.reverse = sse2Reverse;
+		kernels.countByte = sse2CountByte;
+		kernels.findWhere = sse2FindWhere;
+		kernels.countWhere = sse2CountWhere;
+		kernels.filterWhere = sse2FilterWhere;
+		kernels.sum = sse2Sum;
+		kernels.minMax = sse2MinMax;
+	}
+#endif
+
+	kernels.level = level;
+	simdKernels = kernels;
+
+	return SUCCESS;
+}
+
+/**
+ * @fn int simdGetLevel(void)
+ * @brief 현재 선택된 SIMD 명령어 수준을 반환하는 함수
+ * @return 현재 SIMD 명령어 수준 반환 (SIMD_LEVEL 열거형 참고)
+ */
+int simdGetLevel(void)
+{
+	return simdKernels.level;
+}
+
+/**
+ * @fn const char *simdGetLevelName(int level)
+ * @brief SIMD 명령어 수준의 이름을 반환하는 함수
+ * @param level SIMD 명령어 수준(입력, SIMD_LEVEL 열거형 참고)
+ * @return 항상 수준 이름 정적 문자열 반환
+ */
+const char *simdGetLevelName(int level)
+{
+	switch(level)
+	{
+		case SIMD_LEVEL_SCALAR:	return "scalar";
+		case SIMD_LEVEL_SSE2:	return "sse2";
+		case SIMD_LEVEL_AVX2:	return "avx2";
+		case SIMD_LEVEL_AVX512:	return "avx512";
+		default:				return "unknown";
+	}
+}
+
+/**
+ * @fn void simdSetStreamingThreshold(size_t bytes)
+ * @brief 채우기 커널이 streaming store 를 사용하기 시작하는 크기를 설정하는 함수
+ * 마지막 단계 캐시보다 큰 영역을 채울 때 캐시를 오염시키지 않도록 기본값은 마지막 단계 캐시 크기이다.
+ * @param bytes 기준 크기(입력, 바이트, 0 이면 기본값으로 되돌림)
+ * @return 반환값 없음
+ */
+void simdSetStreamingThreshold(size_t bytes)
+{
+	if(bytes == 0)
+	{
+		long cacheSize = 0;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+		cacheSize = sysconf(_SC_LEVEL3_CACHE_SIZE);
+		if(cacheSize <= 0) cacheSize = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+		bytes = (cacheSize > 0) ? (size_t)cacheSize : SIMD_DEFAULT_STREAMING_THRESHOLD;
+	}
+
+	simdStreamingThreshold = bytes;
+}
+
+/**
+ * @fn size_t simdGetStreamingThreshold(void)
+ * @brief 채우기 커널이 streaming store 를 사용하기 시작하는 크기를 반환하는 함수
+ * @return 기준 크기 반환 (바이트)
+ */
+size_t simdGetStreamingThreshold(void)
+{
+	return simdStreamingThreshold;
+}
+
+/**
+ * @fn void simdFill(int *data, size_t n, int datum)
+ * @brief 배열을 지정한 값으로 채우는 함수
+ * 채울 크기가 기준 크기(simdSetStreamingThreshold) 이상이면 streaming store 를 사용한다.
+ * @param data 채울 배열(출력)
+ * @param n 채울 원소 개수(입력)
+ * @param datum 채울 값(입력)
+ * @return 반환값 없음
+ */
+void simdFill(int *data, size_t n, int datum)
+{
+	int isStreaming = ((n * sizeof(int)) >= simdStreamingThreshold) ? YES : NO;
+	simdKernels.fill(data, n, datum, isStreaming);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int simdDetectLevel(void)
+ * @brief cpuid 로 CPU(와 운영체제)가 지원하는 가장 높은 SIMD 명령어 수준을 확인하는 함수
+ * @return 지원하는 가장 높은 SIMD 명령어 수준 반환
+ */
+static int simdDetectLevel(void)
+{
+#if SIMD_IS_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512f")) return SIMD_LEVEL_AVX512;
+	if(__builtin_cpu_supports("avx2")) return SIMD_LEVEL_AVX2;
+	if(__builtin_cpu_supports("sse2")) return SIMD_LEVEL_SSE2;
+#endif
+	return SIMD_LEVEL_SCALAR;
+}
+
+/**
+ * @fn static void simdInitialize(void)
+ * @brief 프로그램 시작 시 한 번 실행되어 CPU 가 지원하는 가장 높은 수준의 커널들을 선택하는 함수
+ * @return 반환값 없음
+ */
+static void simdInitialize(void)
+{
+	simdBuildCompressTable();
+	simdSetLevel(SIMD_LEVEL_AVX512);
+	simdSetStreamingThreshold(0);
+}
+
+/**
+ * @fn static void simdBuildCompressTable(void)
+ * @brief AVX2 필터 커널이 사용하는 레인 재배치 표를 생성하는 함수
+ * 마스크마다 비트가 1 인 레인 번호를 앞에서부터 채우고, 남는 칸은 0 으로 채운다.
+ * @return 반환값 없음
+ */
+static void simdBuildCompressTable(void)
+{
+	unsigned int mask = 0;
+	for(; mask < 256; mask++)
+	{
+		unsigned int position = 0;
+		unsigned int lane = 0;
+		for(; lane < 8; lane++)
+		{
+			if((mask >> lane) & 1U) simdCompressTable[mask][position++] = (uint8_t)lane;
+		}
+		for(; position < 8; position++)
+		{
+			simdCompressTable[mask][position] = 0;
+		}
+	}
+}
+
+/**
+ * @fn static size_t scalarIndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 첫 번째 인덱스를 검색하는 스칼라 커널
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+static size_t scalarIndexOf(const int *data, size_t n, int datum)
+{
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		if(data[loopIndex] == datum) return loopIndex;
+	}
+	return SIMD_NPOS;
+}
+
+/**
+ * @fn static size_t scalarLastIndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 마지막 인덱스를 검색하는 스칼라 커널
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+static size_t scalarLastIndexOf(const int *data, size_t n, int datum)
+{
+	size_t loopIndex = n;
+	while(loopIndex > 0)
+	{
+		loopIndex--;
+		if(data[loopIndex] == datum) return loopIndex;
+	}
+	return SIMD_NPOS;
+}
+
+/**
+ * @fn static size_t scalarCount(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 개수를 세는 스칼라 커널
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 셀 값(입력)
+ * @return 항상 지정한 값의 개수 반환
+ */
+static size_t scalarCount(const int *data, size_t n, int datum)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		count += (data[loopIndex] == datum) ? 1 : 0;
+	}
+	return count;
+}
+
+/**
+ * @fn static size_t scalarCountByte(const char *data, size_t n, char byte)
+ * @brief 문자열에서 지정한 바이트의 개수를 세는 스칼라 커널
+ * @param data 검사할 문자열(입력, 읽기 전용)
+ * @param n 문자열 길이(입력)
+ * @param byte 개수를 셀 바이트(입력)
+ * @return 항상 지정한 바이트의 개수 반환
+ */
+static size_t scalarCountByte(const char *data, size_t n, char byte)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		count += (data[loopIndex] == byte) ? 1 : 0;
+	}
+	return count;
+}
+
+/**
+ * @fn static void scalarFill(int *data, size_t n, int datum, int isStreaming)
+ * @brief 배열을 지정한 값으로 채우는 스칼라 커널
+ * @param data 채울 배열(출력)
+ * @param n 채울 원소 개수(입력)
+ * @param datum 채울 값(입력)
+ * @param isStreaming 사용하지 않음
+ * @return 반환값 없음
+ */
+static void scalarFill(int *data, size_t n, int datum, int isStreaming)
+{
+	(void)isStreaming;
+
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		data[loopIndex] = datum;
+	}
+}
+
+/**
+ * @fn static void scalarReverse(int *data, size_t n)
+ * @brief 원소들을 제자리에서 역순으로 저장하는 스칼라 커널
+ * @param data 역순으로 저장할 배열(입력, 출력)
+ * @param n 배열의 원소 개수(입력)
+ * @return 반환값 없음
+ */
+static void scalarReverse(int *data, size_t n)
+{
+	if(n < 2) return;
+
+	size_t leftIndex = 0;
+	size_t rightIndex = n - 1;
+	int temp = 0;
+
+	for( ; leftIndex < rightIndex; leftIndex++, rightIndex--)
+	{
+		temp = data[leftIndex];
+		data[leftIndex] = data[rightIndex];
+		data[rightIndex] = temp;
+	}
+}
+
+/**
+ * @fn static int scalarPredicateMatch(int value, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 컴파일된 조건 서술자를 원소 하나에 대해 평가하는 함수
+ * 조건 커널들이 벡터 폭보다 작은 나머지 원소를 처리할 때도 사용한다.
+ * @param value 검사할 값(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 일치하면 1, 아니면 0 반환
+ */
+static int scalarPredicateMatch(int value, const dynamicIntArrayPredicateProgram_t *program)
+{
+	int stack[DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS];
+	size_t top = 0;
+	size_t stepIndex = 0;
+
+	for(; stepIndex < program->stepCount; stepIndex++)
+	{
+		const dynamicIntArrayPredicateStep_t *step = &program->steps[stepIndex];
+		switch(step->kind)
+		{
+			case SIMD_PREDICATE_CONSTANT: stack[top++] = (step->operand1 == YES); break;
+			case SIMD_PREDICATE_EQUAL: stack[top++] = (value == step->operand1); break;
+			case SIMD_PREDICATE_LESS: stack[top++] = (value < step->operand1); break;
+			case SIMD_PREDICATE_GREATER: stack[top++] = (value > step->operand1); break;
+			case SIMD_PREDICATE_RANGE: stack[top++] = (((unsigned int)value - (unsigned int)step->operand1) <= (unsigned int)step->operand2); break;
+			case SIMD_PREDICATE_BITS_EQUAL: stack[top++] = ((value & step->operand1) == step->operand2); break;
+			case SIMD_PREDICATE_NOT: stack[top - 1] = !stack[top - 1]; break;
+			case SIMD_PREDICATE_AND: top--; stack[top - 1] = stack[top - 1] & stack[top]; break;
+			case SIMD_PREDICATE_OR: top--; stack[top - 1] = stack[top - 1] | stack[top]; break;
+			default: break;
+		}
+	}
+
+	return stack[0];
+}
+
+/**
+ * @fn static size_t scalarFindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 첫 번째 인덱스를 검색하는 스칼라 커널
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+static size_t scalarFindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		if(scalarPredicateMatch(data[loopIndex], program)) return loopIndex;
+	}
+	return SIMD_NPOS;
+}
+
+/**
+ * @fn static size_t scalarCountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 원소의 개수를 세는 스칼라 커널
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 항상 일치하는 원소의 개수 반환
+ */
+static size_t scalarCountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		count += (size_t)scalarPredicateMatch(data[loopIndex], program);
+	}
+	return count;
+}
+
+/**
+ * @fn static size_t scalarFilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+ * @brief 조건 서술자와 일치하는 원소들을 순서대로 모으는 스칼라 커널
+ * 일치 여부와 관계없이 항상 저장하고 일치할 때만 출력 위치를 옮겨서 분기하지 않는다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @param out 일치하는 원소들을 저장할 배열(출력, n 개를 저장할 수 있어야 함)
+ * @return 항상 저장한 원소의 개수 반환
+ */
+static size_t scalarFilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		out[count] = data[loopIndex];
+		count += (size_t)scalarPredicateMatch(data[loopIndex], program);
+	}
+	return count;
+}
+
+/**
+ * @fn static int64_t scalarSum(const int *data, size_t n)
+ * @brief 원소들의 합을 64 비트로 누적해서 구하는 스칼라 커널
+ * @param data 합을 구할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @return 항상 원소들의 합 반환
+ */
+static int64_t scalarSum(const int *data, size_t n)
+{
+	int64_t sum = 0;
+	size_t loopIndex = 0;
+	for(; loopIndex < n; loopIndex++)
+	{
+		sum += data[loopIndex];
+	}
+	return sum;
+}
+
+/**
+ * @fn static void scalarMinMax(const int *data, size_t n, int *min, int *max)
+ * @brief 원소들의 최솟값과 최댓값을 함께 구하는 스칼라 커널
+ * @param data 검사할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력, 1 이상)
+ * @param min 최솟값(출력)
+ * @param max 최댓값(출력)
+ * @return 반환값 없음
+ */
+static void scalarMinMax(const int *data, size_t n, int *min, int *max)
+{
+	int minValue = data[0];
+	int maxValue = data[0];
+	size_t loopIndex = 1;
+	for(; loopIndex < n; loopIndex++)
+	{
+		minValue = (data[loopIndex] < minValue) ? data[loopIndex] : minValue;
+		maxValue = (data[loopIndex] > maxValue) ? data[loopIndex] : maxValue;
+	}
+	*min = minValue;
+	*max = maxValue;
+}
+
+#if SIMD_IS_X86
+
+/**
+ * @fn static size_t sse2IndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 첫 번째 인덱스를 검색하는 SSE2 커널
+ * 한 번에 16 개씩 비교(compare)하고 movemask 로 일치 여부를 확인해서 찾는 즉시 반환한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("sse2")))
+static size_t sse2IndexOf(const int *data, size_t n, int datum)
+{
+	const __m128i key = _mm_set1_epi32(datum);
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 16) <= n; loopIndex += 16)
+	{
+		__m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex)), key);
+		__m128i c1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex + 4)), key);
+		__m128i c2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex + 8)), key);
+		__m128i c3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex + 12)), key);
+		__m128i any = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+
+		if(_mm_movemask_epi8(any) != 0)
+		{
+			unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c0))
+				| ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c1)) << 4)
+				| ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c2)) << 8)
+				| ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c3)) << 12);
+			return loopIndex + (size_t)__builtin_ctz(mask);
+		}
+	}
+
+	for(; (loopIndex + 4) <= n; loopIndex += 4)
+	{
+		__m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex)), key);
+		unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c0));
+		if(mask != 0) return loopIndex + (size_t)__builtin_ctz(mask);
+	}
+
+	size_t result = scalarIndexOf(data + loopIndex, n - loopIndex, datum);
+	return (result == SIMD_NPOS) ? SIMD_NPOS : (loopIndex + result);
+}
+
+/**
+ * @fn static size_t sse2LastIndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 마지막 인덱스를 검색하는 SSE2 커널
+ * 배열의 끝에서부터 한 번에 16 개씩 비교해서 찾는 즉시 반환한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("sse2")))
+static size_t sse2LastIndexOf(const int *data, size_t n, int datum)
+{
+	const __m128i key = _mm_set1_epi32(datum);
+	size_t loopIndex = n;
+
+	while(loopIndex >= 16)
+	{
+		loopIndex -= 16;
+		__m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex)), key);
+		__m128i c1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex + 4)), key);
+		__m128i c2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex + 8)), key);
+		__m128i c3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex + 12)), key);
+		__m128i any = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+
+		if(_mm_movemask_epi8(any) != 0)
+		{
+			unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c0))
+				| ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c1)) << 4)
+				| ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c2)) << 8)
+				| ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c3)) << 12);
+			return loopIndex + (size_t)(31 - __builtin_clz(mask));
+		}
+	}
+
+	return scalarLastIndexOf(data, loopIndex, datum);
+}
+
+/**
+ * @fn static size_t sse2Count(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 개수를 세는 SSE2 커널
+ * 비교 결과(일치하면 -1)를 레인별로 빼서 누적하고, 블록마다 레인 값을 합산한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 셀 값(입력)
+ * @return 항상 지정한 값의 개수 반환
+ */
+__attribute__((target("sse2")))
+static size_t sse2Count(const int *data, size_t n, int datum)
+{
+	const __m128i key = _mm_set1_epi32(datum);
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	while((loopIndex + 4) <= n)
+	{
+		size_t blockEnd = ((n - loopIndex) > SIMD_COUNT_BLOCK) ? (loopIndex + SIMD_COUNT_BLOCK) : n;
+		__m128i accumulator = _mm_setzero_si128();
+
+		for(; (loopIndex + 4) <= blockEnd; loopIndex += 4)
+		{
+			__m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + loopIndex)), key);
+			accumulator = _mm_sub_epi32(accumulator, c0);
+		}
+
+		unsigned int lanes[4];
+		_mm_storeu_si128((__m128i*)lanes, accumulator);
+		count += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+
+	return count + scalarCount(data + loopIndex, n - loopIndex, datum);
+}
+
+/**
+ * @fn static size_t sse2CountByte(const char *data, size_t n, char byte)
+ * @brief 문자열에서 지정한 바이트의 개수를 세는 SSE2 커널
+ * 비교 결과를 바이트 레인에 누적하다가 넘치기 전에(255 블록마다) psadbw 로 합산한다.
+ * @param data 검사할 문자열(입력, 읽기 전용)
+ * @param n 문자열 길이(입력)
+ * @param byte 개수를 셀 바이트(입력)
+ * @return 항상 지정한 바이트의 개수 반환
+ */
+__attribute__((target("sse2")))
+static size_t sse2CountByte(const char *data, size_t n, char byte)
+{
+	const __m128i key = _mm_set1_epi8(byte);
+	const __m128i zero = _mm_setzero_si128();
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	while((loopIndex + 16) <= n)
+	{
+		size_t blockCount = (n - loopIndex) / 16;
+		if(blockCount > 255) blockCount = 255;
+		size_t blockEnd = loopIndex + (blockCount * 16);
+
+		__m128i accumulator = zero;
+		for(; loopIndex < blockEnd; loopIndex += 16)
+		{
+			accumulator = _mm_sub_epi8(accumulator, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + loopIndex)), key));
+		}
+
+		__m128i sums = _mm_sad_epu8(accumulator, zero);
+		count += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+	}
+
+	return count + scalarCountByte(data + loopIndex, n - loopIndex, byte);
+}
+
+/**
+ * @fn static void sse2Fill(int *data, size_t n, int datum, int isStreaming)
+ * @brief 배열을 지정한 값으로 채우는 SSE2 커널
+ * 16 바이트 경계까지는 스칼라로 채우고, 이후는 정렬된 벡터 store (또는 streaming store)로 채운다.
+ * @param data 채울 배열(출력)
+ * @param n 채울 원소 개수(입력)
+ * @param datum 채울 값(입력)
+ * @param isStreaming streaming store 사용 여부(입력, YES 또는 NO)
+ * @return 반환값 없음
+ */
+__attribute__((target("sse2")))
+static void sse2Fill(int *data, size_t n, int datum, int isStreaming)
+{
+	const __m128i value = _mm_set1_epi32(datum);
+	size_t loopIndex = 0;
+
+	for(; (loopIndex < n) && ((((uintptr_t)(data + loopIndex)) & 15) != 0); loopIndex++)
+	{
+		data[loopIndex] = datum;
+	}
+
+	if(isStreaming == YES)
+	{
+		for(; (loopIndex + 4) <= n; loopIndex += 4)
+		{
+			_mm_stream_si128((__m128i*)(data + loopIndex), value);
+		}
+		_mm_sfence();
+	}
+	else
+	{
+		for(; (loopIndex + 4) <= n; loopIndex += 4)
+		{
+			_mm_store_si128((__m128i*)(data + loopIndex), value);
+		}
+	}
+
+	scalarFill(data + loopIndex, n - loopIndex, datum, NO);
+}
+
+/**
+ * @fn static void sse2Reverse(int *data, size_t n)
+ * @brief 원소들을 제자리에서 역순으로 저장하는 SSE2 커널
+ * 양 끝에서 4 개씩 읽어 레인 순서를 뒤집은(shuffle) 뒤 서로 반대편에 저장하고, 가운데 남은 원소들은 스칼라로 처리한다.
+ * @param data 역순으로 저장할 배열(입력, 출력)
+ * @param n 배열의 원소 개수(입력)
+ * @return 반환값 없음
+ */
+__attribute__((target("sse2")))
+static void sse2Reverse(int *data, size_t n)
+{
+	size_t leftIndex = 0;
+	size_t rightIndex = n;
+
+	while((rightIndex - leftIndex) >= 8)
+	{
+		rightIndex -= 4;
+		__m128i left = _mm_loadu_si128((const __m128i*)(data + leftIndex));
+		__m128i right = _mm_loadu_si128((const __m128i*)(data + rightIndex));
+		_mm_storeu_si128((__m128i*)(data + leftIndex), _mm_shuffle_epi32(right, 0x1B));
+		_mm_storeu_si128((__m128i*)(data + rightIndex), _mm_shuffle_epi32(left, 0x1B));
+		leftIndex += 4;
+	}
+
+	scalarReverse(data + leftIndex, rightIndex - leftIndex);
+}
+
+/**
+ * @fn static __m128i sse2PredicateMask(__m128i value, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 컴파일된 조건 서술자를 원소 4 개에 대해 평가하는 SSE2 함수
+ * @param value 검사할 원소들(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 일치하는 레인은 -1, 아니면 0 인 마스크 반환
+ */
+__attribute__((target("sse2")))
+static inline __m128i sse2PredicateMask(__m128i value, const dynamicIntArrayPredicateProgram_t *program)
+{
+	const __m128i allOnes = _mm_set1_epi32(-1);
+	const __m128i signBit = _mm_set1_epi32(INT_MIN);
+	__m128i stack[DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS];
+	size_t top = 0;
+	size_t stepIndex = 0;
+
+	for(; stepIndex < program->stepCount; stepIndex++)
+	{
+		const dynamicIntArrayPredicateStep_t *step = &program->steps[stepIndex];
+		switch(step->kind)
+		{
+			case SIMD_PREDICATE_CONSTANT: stack[top++] = (step->operand1 == YES) ? allOnes : _mm_setzero_si128(); break;
+			case SIMD_PREDICATE_EQUAL: stack[top++] = _mm_cmpeq_epi32(value, _mm_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_LESS: stack[top++] = _mm_cmplt_epi32(value, _mm_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_GREATER: stack[top++] = _mm_cmpgt_epi32(value, _mm_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_RANGE:
+			{
+				// 부호 비트를 뒤집어서 부호 없는 비교를 부호 있는 비교로 바꾼다.
+				__m128i offset = _mm_xor_si128(_mm_sub_epi32(value, _mm_set1_epi32(step->operand1)), signBit);
+				__m128i width = _mm_xor_si128(_mm_set1_epi32(step->operand2), signBit);
+				stack[top++] = _mm_xor_si128(_mm_cmpgt_epi32(offset, width), allOnes);
+				break;
+			}
+			case SIMD_PREDICATE_BITS_EQUAL: stack[top++] = _mm_cmpeq_epi32(_mm_and_si128(value, _mm_set1_epi32(step->operand1)), _mm_set1_epi32(step->operand2)); break;
+			case SIMD_PREDICATE_NOT: stack[top - 1] = _mm_xor_si128(stack[top - 1], allOnes); break;
+			case SIMD_PREDICATE_AND: top--; stack[top - 1] = _mm_and_si128(stack[top - 1], stack[top]); break;
+			case SIMD_PREDICATE_OR: top--; stack[top - 1] = _mm_or_si128(stack[top - 1], stack[top]); break;
+			default: break;
+		}
+	}
+
+	return stack[0];
+}
+
+/**
+ * @fn static size_t sse2FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 첫 번째 인덱스를 검색하는 SSE2 커널
+ * 한 번에 4 개씩 평가하고 movemask 로 만든 비트 마스크로 일치 여부를 확인해서 찾는 즉시 반환한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("sse2")))
+static size_t sse2FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 4) <= n; loopIndex += 4)
+	{
+		__m128i m0 = sse2PredicateMask(_mm_loadu_si128((const __m128i*)(data + loopIndex)), program);
+		unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(m0));
+		if(mask != 0) return loopIndex + (size_t)__builtin_ctz(mask);
+	}
+
+	size_t result = scalarFindWhere(data + loopIndex, n - loopIndex, program);
+	return (result == SIMD_NPOS) ? SIMD_NPOS : (loopIndex + result);
+}
+
+/**
+ * @fn static size_t sse2CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 원소의 개수를 세는 SSE2 커널
+ * 평가 결과 마스크(일치하면 -1)를 레인별로 빼서 누적하고, 블록마다 레인 값을 합산한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 항상 일치하는 원소의 개수 반환
+ */
+__attribute__((target("sse2")))
+static size_t sse2CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	while((loopIndex + 4) <= n)
+	{
+		size_t blockEnd = ((n - loopIndex) > SIMD_COUNT_BLOCK) ? (loopIndex + SIMD_COUNT_BLOCK) : n;
+		__m128i accumulator = _mm_setzero_si128();
+
+		for(; (loopIndex + 4) <= blockEnd; loopIndex += 4)
+		{
+			accumulator = _mm_sub_epi32(accumulator, sse2PredicateMask(_mm_loadu_si128((const __m128i*)(data + loopIndex)), program));
+		}
+
+		unsigned int lanes[4];
+		_mm_storeu_si128((__m128i*)lanes, accumulator);
+		count += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+
+	return count + scalarCountWhere(data + loopIndex, n - loopIndex, program);
+}
+
+/**
+ * @fn static size_t sse2FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+ * @brief 조건 서술자와 일치하는 원소들을 순서대로 모으는 SSE2 커널
+ * SSE2 에는 레인 재배치 명령어가 없으므로, 4 개씩 만든 비트 마스크의 비트마다 분기 없이 저장하고 출력 위치를 옮긴다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @param out 일치하는 원소들을 저장할 배열(출력, n 개를 저장할 수 있어야 함)
+ * @return 항상 저장한 원소의 개수 반환
+ */
+__attribute__((target("sse2")))
+static size_t sse2FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 4) <= n; loopIndex += 4)
+	{
+		__m128i m0 = sse2PredicateMask(_mm_loadu_si128((const __m128i*)(data + loopIndex)), program);
+		unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(m0));
+		out[count] = data[loopIndex];
+		count += mask & 1;
+		out[count] = data[loopIndex + 1];
+		count += (mask >> 1) & 1;
+		out[count] = data[loopIndex + 2];
+		count += (mask >> 2) & 1;
+		out[count] = data[loopIndex + 3];
+		count += (mask >> 3) & 1;
+	}
+
+	return count + scalarFilterWhere(data + loopIndex, n - loopIndex, program, out + count);
+}
+
+/**
+ * @fn static int64_t sse2Sum(const int *data, size_t n)
+ * @brief 원소들의 합을 64 비트로 누적해서 구하는 SSE2 커널
+ * 부호 마스크와 섞어서(unpack) 32 비트 원소를 64 비트로 부호 확장한 뒤 레인별로 누적하므로 중간 합이 넘치지 않는다.
+ * @param data 합을 구할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @return 항상 원소들의 합 반환
+ */
+__attribute__((target("sse2")))
+static int64_t sse2Sum(const int *data, size_t n)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i accumulator0 = _mm_setzero_si128();
+	__m128i accumulator1 = _mm_setzero_si128();
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 4) <= n; loopIndex += 4)
+	{
+		__m128i value = _mm_loadu_si128((const __m128i*)(data + loopIndex));
+		__m128i sign = _mm_cmpgt_epi32(zero, value);
+		accumulator0 = _mm_add_epi64(accumulator0, _mm_unpacklo_epi32(value, sign));
+		accumulator1 = _mm_add_epi64(accumulator1, _mm_unpackhi_epi32(value, sign));
+	}
+
+	int64_t lanes[2];
+	_mm_storeu_si128((__m128i*)lanes, _mm_add_epi64(accumulator0, accumulator1));
+	return lanes[0] + lanes[1] + scalarSum(data + loopIndex, n - loopIndex);
+}
+
+/**
+ * @fn static void sse2MinMax(const int *data, size_t n, int *min, int *max)
+ * @brief 원소들의 최솟값과 최댓값을 함께 구하는 SSE2 커널
+ * SSE2 에는 32 비트 정수 min/max 명령어가 없으므로 비교 결과 마스크로 값을 선택한다.
+ * @param data 검사할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력, 1 이상)
+ * @param min 최솟값(출력)
+ * @param max 최댓값(출력)
+ * @return 반환값 없음
+ */
+__attribute__((target("sse2")))
+static void sse2MinMax(const int *data, size_t n, int *min, int *max)
+{
+	if(n < 4)
+	{
+		scalarMinMax(data, n, min, max);
+		return;
+	}
+
+	__m128i minValue = _mm_loadu_si128((const __m128i*)data);
+	__m128i maxValue = minValue;
+	size_t loopIndex = 4;
+
+	for(; (loopIndex + 4) <= n; loopIndex += 4)
+	{
+		__m128i value = _mm_loadu_si128((const __m128i*)(data + loopIndex));
+		__m128i isLess = _mm_cmplt_epi32(value, minValue);
+		__m128i isGreater = _mm_cmpgt_epi32(value, maxValue);
+		minValue = _mm_or_si128(_mm_and_si128(isLess, value), _mm_andnot_si128(isLess, minValue));
+		maxValue = _mm_or_si128(_mm_and_si128(isGreater, value), _mm_andnot_si128(isGreater, maxValue));
+	}
+
+	int minLanes[4];
+	int maxLanes[4];
+	_mm_storeu_si128((__m128i*)minLanes, minValue);
+	_mm_storeu_si128((__m128i*)maxLanes, maxValue);
+
+	int laneMin = 0;
+	int laneMax = 0;
+	int restMin = 0;
+	int restMax = 0;
+	scalarMinMax(minLanes, 4, &laneMin, &restMax);
+	scalarMinMax(maxLanes, 4, &restMin, &laneMax);
+	if(loopIndex < n)
+	{
+		scalarMinMax(data + loopIndex, n - loopIndex, &restMin, &restMax);
+		laneMin = (restMin < laneMin) ? restMin : laneMin;
+		laneMax = (restMax > laneMax) ? restMax : laneMax;
+	}
+
+	*min = laneMin;
+	*max = laneMax;
+}
+
+/**
+ * @fn static size_t avx2IndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 첫 번째 인덱스를 검색하는 AVX2 커널
+ * 한 번에 32 개씩 비교(compare)하고 movemask 로 일치 여부를 확인해서 찾는 즉시 반환한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("avx2")))
+static size_t avx2IndexOf(const int *data, size_t n, int datum)
+{
+	const __m256i key = _mm256_set1_epi32(datum);
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 32) <= n; loopIndex += 32)
+	{
+		__m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex)), key);
+		__m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex + 8)), key);
+		__m256i c2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex + 16)), key);
+		__m256i c3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex + 24)), key);
+		__m256i any = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3));
+
+		if(_mm256_testz_si256(any, any) == 0)
+		{
+			unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c0))
+				| ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c1)) << 8)
+				| ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c2)) << 16)
+				| ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c3)) << 24);
+			return loopIndex + (size_t)__builtin_ctz(mask);
+		}
+	}
+
+	for(; (loopIndex + 8) <= n; loopIndex += 8)
+	{
+		__m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex)), key);
+		unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c0));
+		if(mask != 0) return loopIndex + (size_t)__builtin_ctz(mask);
+	}
+
+	size_t result = scalarIndexOf(data + loopIndex, n - loopIndex, datum);
+	return (result == SIMD_NPOS) ? SIMD_NPOS : (loopIndex + result);
+}
+
+/**
+ * @fn static size_t avx2LastIndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 마지막 인덱스를 검색하는 AVX2 커널
+ * 배열의 끝에서부터 한 번에 32 개씩 비교해서 찾는 즉시 반환한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("avx2")))
+static size_t avx2LastIndexOf(const int *data, size_t n, int datum)
+{
+	const __m256i key = _mm256_set1_epi32(datum);
+	size_t loopIndex = n;
+
+	while(loopIndex >= 32)
+	{
+		loopIndex -= 32;
+		__m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex)), key);
+		__m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex + 8)), key);
+		__m256i c2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex + 16)), key);
+		__m256i c3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex + 24)), key);
+		__m256i any = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3));
+
+		if(_mm256_testz_si256(any, any) == 0)
+		{
+			unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c0))
+				| ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c1)) << 8)
+				| ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c2)) << 16)
+				| ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c3)) << 24);
+			return loopIndex + (size_t)(31 - __builtin_clz(mask));
+		}
+	}
+
+	return sse2LastIndexOf(data, loopIndex, datum);
+}
+
+/**
+ * @fn static size_t avx2Count(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 개수를 세는 AVX2 커널
+ * 비교 결과(일치하면 -1)를 레인별로 빼서 누적하고, 블록마다 레인 값을 합산한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 셀 값(입력)
+ * @return 항상 지정한 값의 개수 반환
+ */
+__attribute__((target("avx2")))
+static size_t avx2Count(const int *data, size_t n, int datum)
+{
+	const __m256i key = _mm256_set1_epi32(datum);
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	while((loopIndex + 8) <= n)
+	{
+		size_t blockEnd = ((n - loopIndex) > SIMD_COUNT_BLOCK) ? (loopIndex + SIMD_COUNT_BLOCK) : n;
+		__m256i accumulator = _mm256_setzero_si256();
+
+		for(; (loopIndex + 8) <= blockEnd; loopIndex += 8)
+		{
+			__m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + loopIndex)), key);
+			accumulator = _mm256_sub_epi32(accumulator, c0);
+		}
+
+		unsigned int lanes[8];
+		_mm256_storeu_si256((__m256i*)lanes, accumulator);
+		count += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+	}
+
+	return count + scalarCount(data + loopIndex, n - loopIndex, datum);
+}
+
+/**
+ * @fn static size_t avx2CountByte(const char *data, size_t n, char byte)
+ * @brief 문자열에서 지정한 바이트의 개수를 세는 AVX2 커널 (AVX-512 수준에서도 사용)
+ * 비교 결과를 바이트 레인에 누적하다가 넘치기 전에(255 블록마다) vpsadbw 로 합산한다.
+ * @param data 검사할 문자열(입력, 읽기 전용)
+ * @param n 문자열 길이(입력)
+ * @param byte 개수를 셀 바이트(입력)
+ * @return 항상 지정한 바이트의 개수 반환
+ */
+__attribute__((target("avx2")))
+static size_t avx2CountByte(const char *data, size_t n, char byte)
+{
+	const __m256i key = _mm256_set1_epi8(byte);
+	const __m256i zero = _mm256_setzero_si256();
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	while((loopIndex + 32) <= n)
+	{
+		size_t blockCount = (n - loopIndex) / 32;
+		if(blockCount > 255) blockCount = 255;
+		size_t blockEnd = loopIndex + (blockCount * 32);
+
+		__m256i accumulator = zero;
+		for(; loopIndex < blockEnd; loopIndex += 32)
+		{
+			accumulator = _mm256_sub_epi8(accumulator, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + loopIndex)), key));
+		}
+
+		__m256i sums = _mm256_sad_epu8(accumulator, zero);
+		__m128i halfSums = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+		count += (size_t)_mm_cvtsi128_si32(halfSums) + (size_t)_mm_extract_epi16(halfSums, 4);
+	}
+
+	return count + sse2CountByte(data + loopIndex, n - loopIndex, byte);
+}
+
+/**
+ * @fn static void avx2Fill(int *data, size_t n, int datum, int isStreaming)
+ * @brief 배열을 지정한 값으로 채우는 AVX2 커널
+ * 32 바이트 경계까지는 스칼라로 채우고, 이후는 정렬된 벡터 store (또는 streaming store)로 채운다.
+ * @param data 채울 배열(출력)
+ * @param n 채울 원소 개수(입력)
+ * @param datum 채울 값(입력)
+ * @param isStreaming streaming store 사용 여부(입력, YES 또는 NO)
+ * @return 반환값 없음
+ */
+__attribute__((target("avx2")))
+static void avx2Fill(int *data, size_t n, int datum, int isStreaming)
+{
+	const __m256i value = _mm256_set1_epi32(datum);
+	size_t loopIndex = 0;
+
+	for(; (loopIndex < n) && ((((uintptr_t)(data + loopIndex)) & 31) != 0); loopIndex++)
+	{
+		data[loopIndex] = datum;
+	}
+
+	if(isStreaming == YES)
+	{
+		for(; (loopIndex + 8) <= n; loopIndex += 8)
+		{
+			_mm256_stream_si256((__m256i*)(data + loopIndex), value);
+		}
+		_mm_sfence();
+	}
+	else
+	{
+		for(; (loopIndex + 32) <= n; loopIndex += 32)
+		{
+			_mm256_store_si256((__m256i*)(data + loopIndex), value);
+			_mm256_store_si256((__m256i*)(data + loopIndex + 8), value);
+			_mm256_store_si256((__m256i*)(data + loopIndex + 16), value);
+			_mm256_store_si256((__m256i*)(data + loopIndex + 24), value);
+		}
+		for(; (loopIndex + 8) <= n; loopIndex += 8)
+		{
+			_mm256_store_si256((__m256i*)(data + loopIndex), value);
+		}
+	}
+
+	scalarFill(data + loopIndex, n - loopIndex, datum, NO);
+}
+
+/**
+ * @fn static void avx2Reverse(int *data, size_t n)
+ * @brief 원소들을 제자리에서 역순으로 저장하는 AVX2 커널
+ * 양 끝에서 8 개씩 읽어 레인 순서를 뒤집은(permute) 뒤 서로 반대편에 저장하고, 가운데 남은 원소들은 SSE2 커널로 처리한다.
+ * @param data 역순으로 저장할 배열(입력, 출력)
+ * @param n 배열의 원소 개수(입력)
+ * @return 반환값 없음
+ */
+__attribute__((target("avx2")))
+static void avx2Reverse(int *data, size_t n)
+{
+	const __m256i reverseIndex = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	size_t leftIndex = 0;
+	size_t rightIndex = n;
+
+	while((rightIndex - leftIndex) >= 16)
+	{
+		rightIndex -= 8;
+		__m256i left = _mm256_loadu_si256((const __m256i*)(data + leftIndex));
+		__m256i right = _mm256_loadu_si256((const __m256i*)(data + rightIndex));
+		_mm256_storeu_si256((__m256i*)(data + leftIndex), _mm256_permutevar8x32_epi32(right, reverseIndex));
+		_mm256_storeu_si256((__m256i*)(data + rightIndex), _mm256_permutevar8x32_epi32(left, reverseIndex));
+		leftIndex += 8;
+	}
+
+	sse2Reverse(data + leftIndex, rightIndex - leftIndex);
+}
+
+/**
+ * @fn static __m256i avx2PredicateMask(__m256i value, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 컴파일된 조건 서술자를 원소 8 개에 대해 평가하는 AVX2 함수
+ * @param value 검사할 원소들(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 일치하는 레인은 -1, 아니면 0 인 마스크 반환
+ */
+__attribute__((target("avx2")))
+static inline __m256i avx2PredicateMask(__m256i value, const dynamicIntArrayPredicateProgram_t *program)
+{
+	const __m256i allOnes = _mm256_set1_epi32(-1);
+	const __m256i signBit = _mm256_set1_epi32(INT_MIN);
+	__m256i stack[DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS];
+	size_t top = 0;
+	size_t stepIndex = 0;
+
+	for(; stepIndex < program->stepCount; stepIndex++)
+	{
+		const dynamicIntArrayPredicateStep_t *step = &program->steps[stepIndex];
+		switch(step->kind)
+		{
+			case SIMD_PREDICATE_CONSTANT: stack[top++] = (step->operand1 == YES) ? allOnes : _mm256_setzero_si256(); break;
+			case SIMD_PREDICATE_EQUAL: stack[top++] = _mm256_cmpeq_epi32(value, _mm256_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_LESS: stack[top++] = _mm256_cmpgt_epi32(_mm256_set1_epi32(step->operand1), value); break;
+			case SIMD_PREDICATE_GREATER: stack[top++] = _mm256_cmpgt_epi32(value, _mm256_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_RANGE:
+			{
+				// 부호 비트를 뒤집어서 부호 없는 비교를 부호 있는 비교로 바꾼다.
+				__m256i offset = _mm256_xor_si256(_mm256_sub_epi32(value, _mm256_set1_epi32(step->operand1)), signBit);
+				__m256i width = _mm256_xor_si256(_mm256_set1_epi32(step->operand2), signBit);
+				stack[top++] = _mm256_xor_si256(_mm256_cmpgt_epi32(offset, width), allOnes);
+				break;
+			}
+			case SIMD_PREDICATE_BITS_EQUAL: stack[top++] = _mm256_cmpeq_epi32(_mm256_and_si256(value, _mm256_set1_epi32(step->operand1)), _mm256_set1_epi32(step->operand2)); break;
+			case SIMD_PREDICATE_NOT: stack[top - 1] = _mm256_xor_si256(stack[top - 1], allOnes); break;
+			case SIMD_PREDICATE_AND: top--; stack[top - 1] = _mm256_and_si256(stack[top - 1], stack[top]); break;
+			case SIMD_PREDICATE_OR: top--; stack[top - 1] = _mm256_or_si256(stack[top - 1], stack[top]); break;
+			default: break;
+		}
+	}
+
+	return stack[0];
+}
+
+/**
+ * @fn static size_t avx2FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 첫 번째 인덱스를 검색하는 AVX2 커널
+ * 한 번에 8 개씩 평가하고 movemask 로 만든 비트 마스크로 일치 여부를 확인해서 찾는 즉시 반환한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("avx2")))
+static size_t avx2FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 8) <= n; loopIndex += 8)
+	{
+		__m256i m0 = avx2PredicateMask(_mm256_loadu_si256((const __m256i*)(data + loopIndex)), program);
+		unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(m0));
+		if(mask != 0) return loopIndex + (size_t)__builtin_ctz(mask);
+	}
+
+	size_t result = scalarFindWhere(data + loopIndex, n - loopIndex, program);
+	return (result == SIMD_NPOS) ? SIMD_NPOS : (loopIndex + result);
+}
+
+/**
+ * @fn static size_t avx2CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 원소의 개수를 세는 AVX2 커널
+ * 평가 결과 마스크(일치하면 -1)를 레인별로 빼서 누적하고, 블록마다 레인 값을 합산한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 항상 일치하는 원소의 개수 반환
+ */
+__attribute__((target("avx2")))
+static size_t avx2CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	while((loopIndex + 8) <= n)
+	{
+		size_t blockEnd = ((n - loopIndex) > SIMD_COUNT_BLOCK) ? (loopIndex + SIMD_COUNT_BLOCK) : n;
+		__m256i accumulator = _mm256_setzero_si256();
+
+		for(; (loopIndex + 8) <= blockEnd; loopIndex += 8)
+		{
+			accumulator = _mm256_sub_epi32(accumulator, avx2PredicateMask(_mm256_loadu_si256((const __m256i*)(data + loopIndex)), program));
+		}
+
+		unsigned int lanes[8];
+		_mm256_storeu_si256((__m256i*)lanes, accumulator);
+		count += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+	}
+
+	return count + scalarCountWhere(data + loopIndex, n - loopIndex, program);
+}
+
+/**
+ * @fn static size_t avx2FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+ * @brief 조건 서술자와 일치하는 원소들을 순서대로 모으는 AVX2 커널 (compress store)
+ * 8 개씩 만든 비트 마스크로 재배치 표에서 레인 순서를 찾아 일치하는 원소들을 앞쪽 레인으로 모으고,
+ * 8 개를 모두 저장한 뒤 일치하는 개수만큼만 출력 위치를 옮긴다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @param out 일치하는 원소들을 저장할 배열(출력, n 개를 저장할 수 있어야 함)
+ * @return 항상 저장한 원소의 개수 반환
+ */
+__attribute__((target("avx2,popcnt")))
+static size_t avx2FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	// 저장 위치(count)는 loopIndex 를 넘지 않으므로 8 개를 모두 저장해도 out 의 n 개 범위를 벗어나지 않는다.
+	for(; (loopIndex + 8) <= n; loopIndex += 8)
+	{
+		__m256i value = _mm256_loadu_si256((const __m256i*)(data + loopIndex));
+		unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(avx2PredicateMask(value, program)));
+		__m256i permutation = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)simdCompressTable[mask]));
+		_mm256_storeu_si256((__m256i*)(out + count), _mm256_permutevar8x32_epi32(value, permutation));
+		count += (size_t)__builtin_popcount(mask);
+	}
+
+	return count + scalarFilterWhere(data + loopIndex, n - loopIndex, program, out + count);
+}
+
+/**
+ * @fn static int64_t avx2Sum(const int *data, size_t n)
+ * @brief 원소들의 합을 64 비트로 누적해서 구하는 AVX2 커널
+ * 8 개씩 읽어서 절반씩 64 비트로 부호 확장(vpmovsxdq)한 뒤 레인별로 누적하므로 중간 합이 넘치지 않는다.
+ * @param data 합을 구할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @return 항상 원소들의 합 반환
+ */
+__attribute__((target("avx2")))
+static int64_t avx2Sum(const int *data, size_t n)
+{
+	__m256i accumulator0 = _mm256_setzero_si256();
+	__m256i accumulator1 = _mm256_setzero_si256();
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 8) <= n; loopIndex += 8)
+	{
+		__m256i value = _mm256_loadu_si256((const __m256i*)(data + loopIndex));
+		accumulator0 = _mm256_add_epi64(accumulator0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(value)));
+		accumulator1 = _mm256_add_epi64(accumulator1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(value, 1)));
+	}
+
+	int64_t lanes[4];
+	_mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(accumulator0, accumulator1));
+	return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalarSum(data + loopIndex, n - loopIndex);
+}
+
+/**
+ * @fn static void avx2MinMax(const int *data, size_t n, int *min, int *max)
+ * @brief 원소들의 최솟값과 최댓값을 함께 구하는 AVX2 커널
+ * 8 개씩 vpminsd/vpmaxsd 로 레인별 최솟값과 최댓값을 누적한 뒤 레인 값들을 비교한다.
+ * @param data 검사할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력, 1 이상)
+ * @param min 최솟값(출력)
+ * @param max 최댓값(출력)
+ * @return 반환값 없음
+ */
+__attribute__((target("avx2")))
+static void avx2MinMax(const int *data, size_t n, int *min, int *max)
+{
+	if(n < 8)
+	{
+		scalarMinMax(data, n, min, max);
+		return;
+	}
+
+	__m256i minValue = _mm256_loadu_si256((const __m256i*)data);
+	__m256i maxValue = minValue;
+	size_t loopIndex = 8;
+
+	for(; (loopIndex + 8) <= n; loopIndex += 8)
+	{
+		__m256i value = _mm256_loadu_si256((const __m256i*)(data + loopIndex));
+		minValue = _mm256_min_epi32(minValue, value);
+		maxValue = _mm256_max_epi32(maxValue, value);
+	}
+
+	int minLanes[8];
+	int maxLanes[8];
+	_mm256_storeu_si256((__m256i*)minLanes, minValue);
+	_mm256_storeu_si256((__m256i*)maxLanes, maxValue);
+
+	int laneMin = 0;
+	int laneMax = 0;
+	int restMin = 0;
+	int restMax = 0;
+	scalarMinMax(minLanes, 8, &laneMin, &restMax);
+	scalarMinMax(maxLanes, 8, &restMin, &laneMax);
+	if(loopIndex < n)
+	{
+		scalarMinMax(data + loopIndex, n - loopIndex, &restMin, &restMax);
+		laneMin = (restMin < laneMin) ? restMin : laneMin;
+		laneMax = (restMax > laneMax) ? restMax : laneMax;
+	}
+
+	*min = laneMin;
+	*max = laneMax;
+}
+
+/**
+ * @fn static size_t avx512IndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 첫 번째 인덱스를 검색하는 AVX-512 커널
+ * 한 번에 32 개씩 비교해서 마스크 레지스터로 일치 여부를 확인하고, 남은 원소는 마스크 로드로 처리한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("avx512f")))
+static size_t avx512IndexOf(const int *data, size_t n, int datum)
+{
+	const __m512i key = _mm512_set1_epi32(datum);
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 32) <= n; loopIndex += 32)
+	{
+		__mmask16 m0 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(data + loopIndex)), key);
+		__mmask16 m1 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(data + loopIndex + 16)), key);
+		if((m0 | m1) != 0)
+		{
+			unsigned int mask = (unsigned int)m0 | ((unsigned int)m1 << 16);
+			return loopIndex + (size_t)__builtin_ctz(mask);
+		}
+	}
+
+	for(; loopIndex < n; loopIndex += 16)
+	{
+		size_t rest = n - loopIndex;
+		__mmask16 loadMask = (rest >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1U << rest) - 1);
+		__mmask16 m0 = _mm512_mask_cmpeq_epi32_mask(loadMask, _mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex)), key);
+		if(m0 != 0) return loopIndex + (size_t)__builtin_ctz((unsigned int)m0);
+	}
+
+	return SIMD_NPOS;
+}
+
+/**
+ * @fn static size_t avx512LastIndexOf(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 마지막 인덱스를 검색하는 AVX-512 커널
+ * 배열의 끝에서부터 한 번에 32 개씩 비교하고, 남은 앞부분은 마스크 로드로 처리한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 검색할 값(입력)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("avx512f")))
+static size_t avx512LastIndexOf(const int *data, size_t n, int datum)
+{
+	const __m512i key = _mm512_set1_epi32(datum);
+	size_t loopIndex = n;
+
+	while(loopIndex >= 32)
+	{
+		loopIndex -= 32;
+		__mmask16 m0 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(data + loopIndex)), key);
+		__mmask16 m1 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(data + loopIndex + 16)), key);
+		if((m0 | m1) != 0)
+		{
+			unsigned int mask = (unsigned int)m0 | ((unsigned int)m1 << 16);
+			return loopIndex + (size_t)(31 - __builtin_clz(mask));
+		}
+	}
+
+	while(loopIndex > 0)
+	{
+		size_t blockSize = (loopIndex >= 16) ? 16 : loopIndex;
+		loopIndex -= blockSize;
+		__mmask16 loadMask = (blockSize == 16) ? (__mmask16)0xFFFF : (__mmask16)((1U << blockSize) - 1);
+		__mmask16 m0 = _mm512_mask_cmpeq_epi32_mask(loadMask, _mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex)), key);
+		if(m0 != 0) return loopIndex + (size_t)(31 - __builtin_clz((unsigned int)m0));
+	}
+
+	return SIMD_NPOS;
+}
+
+/**
+ * @fn static size_t avx512Count(const int *data, size_t n, int datum)
+ * @brief 지정한 값의 개수를 세는 AVX-512 커널
+ * 비교 결과 마스크의 비트 개수(popcount)를 누적한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param datum 셀 값(입력)
+ * @return 항상 지정한 값의 개수 반환
+ */
+__attribute__((target("avx512f,popcnt")))
+static size_t avx512Count(const int *data, size_t n, int datum)
+{
+	const __m512i key = _mm512_set1_epi32(datum);
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 16) <= n; loopIndex += 16)
+	{
+		__mmask16 m0 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(data + loopIndex)), key);
+		count += (size_t)__builtin_popcount((unsigned int)m0);
+	}
+
+	if(loopIndex < n)
+	{
+		__mmask16 loadMask = (__mmask16)((1U << (n - loopIndex)) - 1);
+		__mmask16 m0 = _mm512_mask_cmpeq_epi32_mask(loadMask, _mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex)), key);
+		count += (size_t)__builtin_popcount((unsigned int)m0);
+	}
+
+	return count;
+}
+
+/**
+ * @fn static void avx512Fill(int *data, size_t n, int datum, int isStreaming)
+ * @brief 배열을 지정한 값으로 채우는 AVX-512 커널
+ * 64 바이트(캐시 라인) 경계까지는 마스크 store 로 채우고, 이후는 정렬된 벡터 store (또는 streaming store)로 채운다.
+ * @param data 채울 배열(출력)
+ * @param n 채울 원소 개수(입력)
+ * @param datum 채울 값(입력)
+ * @param isStreaming streaming store 사용 여부(입력, YES 또는 NO)
+ * @return 반환값 없음
+ */
+__attribute__((target("avx512f")))
+static void avx512Fill(int *data, size_t n, int datum, int isStreaming)
+{
+	const __m512i value = _mm512_set1_epi32(datum);
+	size_t loopIndex = (size_t)((64 - (((uintptr_t)data) & 63)) & 63) / sizeof(int);
+
+	if(loopIndex > n) loopIndex = n;
+	scalarFill(data, loopIndex, datum, NO);
+
+	if(isStreaming == YES)
+	{
+		for(; (loopIndex + 16) <= n; loopIndex += 16)
+		{
+			_mm512_stream_si512((void*)(data + loopIndex), value);
+		}
+		_mm_sfence();
+	}
+	else
+	{
+		for(; (loopIndex + 16) <= n; loopIndex += 16)
+		{
+			_mm512_store_si512((void*)(data + loopIndex), value);
+		}
+	}
+
+	if(loopIndex < n)
+	{
+		__mmask16 storeMask = (__mmask16)((1U << (n - loopIndex)) - 1);
+		_mm512_mask_storeu_epi32((void*)(data + loopIndex), storeMask, value);
+	}
+}
+
+/**
+ * @fn static void avx512Reverse(int *data, size_t n)
+ * @brief 원소들을 제자리에서 역순으로 저장하는 AVX-512 커널
+ * 양 끝에서 16 개씩 읽어 레인 순서를 뒤집은(permute) 뒤 서로 반대편에 저장하고, 가운데 남은 원소들은 AVX2 커널로 처리한다.
+ * @param data 역순으로 저장할 배열(입력, 출력)
+ * @param n 배열의 원소 개수(입력)
+ * @return 반환값 없음
+ */
+__attribute__((target("avx512f,avx2")))
+static void avx512Reverse(int *data, size_t n)
+{
+	const __m512i reverseIndex = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+	size_t leftIndex = 0;
+	size_t rightIndex = n;
+
+	while((rightIndex - leftIndex) >= 32)
+	{
+		rightIndex -= 16;
+		__m512i left = _mm512_loadu_si512((const void*)(data + leftIndex));
+		__m512i right = _mm512_loadu_si512((const void*)(data + rightIndex));
+		_mm512_storeu_si512((void*)(data + leftIndex), _mm512_permutexvar_epi32(reverseIndex, right));
+		_mm512_storeu_si512((void*)(data + rightIndex), _mm512_permutexvar_epi32(reverseIndex, left));
+		leftIndex += 16;
+	}
+
+	avx2Reverse(data + leftIndex, rightIndex - leftIndex);
+}
+
+/**
+ * @fn static __mmask16 avx512PredicateMask(__m512i value, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 컴파일된 조건 서술자를 원소 16 개에 대해 평가하는 AVX-512 함수
+ * 비교 결과를 마스크 레지스터로 바로 만들고 결합 연산도 마스크 레지스터에서 처리한다.
+ * @param value 검사할 원소들(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 일치하는 레인의 비트가 1 인 마스크 반환
+ */
+__attribute__((target("avx512f")))
+static inline __mmask16 avx512PredicateMask(__m512i value, const dynamicIntArrayPredicateProgram_t *program)
+{
+	__mmask16 stack[DYNAMIC_INT_ARRAY_PREDICATE_MAX_STEPS];
+	size_t top = 0;
+	size_t stepIndex = 0;
+
+	for(; stepIndex < program->stepCount; stepIndex++)
+	{
+		const dynamicIntArrayPredicateStep_t *step = &program->steps[stepIndex];
+		switch(step->kind)
+		{
+			case SIMD_PREDICATE_CONSTANT: stack[top++] = (step->operand1 == YES) ? (__mmask16)0xFFFF : (__mmask16)0; break;
+			case SIMD_PREDICATE_EQUAL: stack[top++] = _mm512_cmpeq_epi32_mask(value, _mm512_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_LESS: stack[top++] = _mm512_cmplt_epi32_mask(value, _mm512_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_GREATER: stack[top++] = _mm512_cmpgt_epi32_mask(value, _mm512_set1_epi32(step->operand1)); break;
+			case SIMD_PREDICATE_RANGE: stack[top++] = _mm512_cmple_epu32_mask(_mm512_sub_epi32(value, _mm512_set1_epi32(step->operand1)), _mm512_set1_epi32(step->operand2)); break;
+			case SIMD_PREDICATE_BITS_EQUAL: stack[top++] = _mm512_cmpeq_epi32_mask(_mm512_and_si512(value, _mm512_set1_epi32(step->operand1)), _mm512_set1_epi32(step->operand2)); break;
+			case SIMD_PREDICATE_NOT: stack[top - 1] = (__mmask16)~stack[top - 1]; break;
+			case SIMD_PREDICATE_AND: top--; stack[top - 1] = (__mmask16)(stack[top - 1] & stack[top]); break;
+			case SIMD_PREDICATE_OR: top--; stack[top - 1] = (__mmask16)(stack[top - 1] | stack[top]); break;
+			default: break;
+		}
+	}
+
+	return stack[0];
+}
+
+/**
+ * @fn static size_t avx512FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 첫 번째 인덱스를 검색하는 AVX-512 커널
+ * 한 번에 16 개씩 평가해서 찾는 즉시 반환하고, 남은 원소는 마스크 로드로 처리한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 성공 시 검색된 인덱스, 실패 시 SIMD_NPOS 반환
+ */
+__attribute__((target("avx512f")))
+static size_t avx512FindWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t loopIndex = 0;
+
+	for(; loopIndex < n; loopIndex += 16)
+	{
+		size_t rest = n - loopIndex;
+		__mmask16 loadMask = (rest >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1U << rest) - 1);
+		__mmask16 m0 = avx512PredicateMask(_mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex)), program) & loadMask;
+		if(m0 != 0) return loopIndex + (size_t)__builtin_ctz((unsigned int)m0);
+	}
+
+	return SIMD_NPOS;
+}
+
+/**
+ * @fn static size_t avx512CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+ * @brief 조건 서술자와 일치하는 원소의 개수를 세는 AVX-512 커널
+ * 평가 결과 마스크의 비트 개수(popcount)를 누적한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @return 항상 일치하는 원소의 개수 반환
+ */
+__attribute__((target("avx512f,popcnt")))
+static size_t avx512CountWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	for(; loopIndex < n; loopIndex += 16)
+	{
+		size_t rest = n - loopIndex;
+		__mmask16 loadMask = (rest >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1U << rest) - 1);
+		__mmask16 m0 = avx512PredicateMask(_mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex)), program) & loadMask;
+		count += (size_t)__builtin_popcount((unsigned int)m0);
+	}
+
+	return count;
+}
+
+/**
+ * @fn static size_t avx512FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+ * @brief 조건 서술자와 일치하는 원소들을 순서대로 모으는 AVX-512 커널 (compress store)
+ * 16 개씩 만든 마스크로 일치하는 레인만 연속해서 저장(compressstore)한다.
+ * @param data 검색할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @param program 컴파일된 조건 서술자(입력, 읽기 전용)
+ * @param out 일치하는 원소들을 저장할 배열(출력, n 개를 저장할 수 있어야 함)
+ * @return 항상 저장한 원소의 개수 반환
+ */
+__attribute__((target("avx512f,popcnt")))
+static size_t avx512FilterWhere(const int *data, size_t n, const dynamicIntArrayPredicateProgram_t *program, int *out)
+{
+	size_t count = 0;
+	size_t loopIndex = 0;
+
+	for(; loopIndex < n; loopIndex += 16)
+	{
+		size_t rest = n - loopIndex;
+		__mmask16 loadMask = (rest >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1U << rest) - 1);
+		__m512i value = _mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex));
+		__mmask16 m0 = avx512PredicateMask(value, program) & loadMask;
+		_mm512_mask_compressstoreu_epi32((void*)(out + count), m0, value);
+		count += (size_t)__builtin_popcount((unsigned int)m0);
+	}
+
+	return count;
+}
+
+/**
+ * @fn static int64_t avx512Sum(const int *data, size_t n)
+ * @brief 원소들의 합을 64 비트로 누적해서 구하는 AVX-512 커널
+ * 16 개씩 읽어서 절반씩 64 비트로 부호 확장한 뒤 레인별로 누적하고, 남은 원소는 마스크 로드(빈 레인은 0)로 처리한다.
+ * @param data 합을 구할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력)
+ * @return 항상 원소들의 합 반환
+ */
+__attribute__((target("avx512f")))
+static int64_t avx512Sum(const int *data, size_t n)
+{
+	__m512i accumulator0 = _mm512_setzero_si512();
+	__m512i accumulator1 = _mm512_setzero_si512();
+	size_t loopIndex = 0;
+
+	for(; loopIndex < n; loopIndex += 16)
+	{
+		size_t rest = n - loopIndex;
+		__mmask16 loadMask = (rest >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1U << rest) - 1);
+		__m512i value = _mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex));
+		accumulator0 = _mm512_add_epi64(accumulator0, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(value)));
+		accumulator1 = _mm512_add_epi64(accumulator1, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(value, 1)));
+	}
+
+	return (int64_t)_mm512_reduce_add_epi64(_mm512_add_epi64(accumulator0, accumulator1));
+}
+
+/**
+ * @fn static void avx512MinMax(const int *data, size_t n, int *min, int *max)
+ * @brief 원소들의 최솟값과 최댓값을 함께 구하는 AVX-512 커널
+ * 16 개씩 레인별 최솟값과 최댓값을 누적하고, 남은 원소는 마스크를 적용한 min/max 로 해당 레인만 갱신한다.
+ * @param data 검사할 배열(입력, 읽기 전용)
+ * @param n 배열의 원소 개수(입력, 1 이상)
+ * @param min 최솟값(출력)
+ * @param max 최댓값(출력)
+ * @return 반환값 없음
+ */
+__attribute__((target("avx512f")))
+static void avx512MinMax(const int *data, size_t n, int *min, int *max)
+{
+	// 첫 번째 원소로 채우고 시작하면 마스크로 건너뛴 레인이 결과에 영향을 주지 않는다.
+	__m512i minValue = _mm512_set1_epi32(data[0]);
+	__m512i maxValue = minValue;
+	size_t loopIndex = 0;
+
+	for(; (loopIndex + 16) <= n; loopIndex += 16)
+	{
+		__m512i value = _mm512_loadu_si512((const void*)(data + loopIndex));
+		minValue = _mm512_min_epi32(minValue, value);
+		maxValue = _mm512_max_epi32(maxValue, value);
+	}
+
+	if(loopIndex < n)
+	{
+		__mmask16 loadMask = (__mmask16)((1U << (n - loopIndex)) - 1);
+		__m512i value = _mm512_maskz_loadu_epi32(loadMask, (const void*)(data + loopIndex));
+		minValue = _mm512_mask_min_epi32(minValue, loadMask, minValue, value);
+		maxValue = _mm512_mask_max_epi32(maxValue, loadMask, maxValue, value);
+	}
+
+	*min = _mm512_reduce_min_epi32(minValue);
+	*max = _mm512_reduce_max_epi32(maxValue);
+}
+
+#endif // #if SIMD_IS_X86
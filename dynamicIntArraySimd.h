@@ -0,0 +1,89 @@
+#ifndef __DYNAMIC_INT_ARRAY_SIMD_H__
+#define __DYNAMIC_INT_ARRAY_SIMD_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Definitions & Macros
+///////////////////////////////////////////////////////////////////////////////////////
+
+// 검색 커널이 값을 찾지 못했을 때 반환하는 인덱스 매크로 상수
+#define SIMD_NPOS	((size_t)-1)
+
+// 마지막 단계 캐시 크기를 알 수 없을 때 사용하는 streaming store 기준 크기 매크로 상수 (바이트)
+#define SIMD_DEFAULT_STREAMING_THRESHOLD	((size_t)8 << 20)
+
+// SIMD 명령어 수준 열거형 (값이 클수록 넓은 벡터 사용)
+enum SIMD_LEVEL
+{
+	SIMD_LEVEL_SCALAR	= 0,	// 벡터 명령어 사용 안 함
+	SIMD_LEVEL_SSE2		= 1,	// 128 비트 (int 4 개)
+	SIMD_LEVEL_AVX2		= 2,	// 256 비트 (int 8 개)
+	SIMD_LEVEL_AVX512	= 3		// 512 비트 (int 16 개)
+};
+
+// 컴파일된 조건 서술자의 단계 종류 열거형 (operand1, operand2 는 dynamicIntArrayPredicateStep_t 의 피연산자)
+// 단계들은 후위 표기법으로 평가되며, 비교 단계는 마스크를 하나 쌓고 결합 단계는 쌓인 마스크를 결합한다.
+enum SIMD_PREDICATE_STEP
+{
+	SIMD_PREDICATE_CONSTANT		= 0,	// operand1 이 YES 이면 모두 일치, NO 이면 모두 불일치
+	SIMD_PREDICATE_EQUAL		= 1,	// value == operand1
+	SIMD_PREDICATE_LESS			= 2,	// value < operand1
+	SIMD_PREDICATE_GREATER		= 3,	// value > operand1
+	SIMD_PREDICATE_RANGE		= 4,	// (unsigned)(value - operand1) <= (unsigned)operand2 (operand2 는 구간 폭)
+	SIMD_PREDICATE_BITS_EQUAL	= 5,	// (value & operand1) == operand2
+	SIMD_PREDICATE_NOT			= 6,	// 마지막 마스크 반전
+	SIMD_PREDICATE_AND			= 7,	// 마지막 두 마스크의 AND
+	SIMD_PREDICATE_OR			= 8		// 마지막 두 마스크의 OR
+};
+
+// 조건 커널이 평가하는 컴파일된 조건 서술자 구조체 (dynamicIntArray.h 참고)
+struct dynamicIntArrayPredicateProgram_s;
+
+// CPU 에 맞게 선택된 커널 함수들을 관리하는 구조체
+typedef struct simdKernels_s simdKernels_t;
+struct simdKernels_s
+{
+	// 선택된 SIMD 명령어 수준
+	int level;
+	// 지정한 값의 첫 번째 인덱스를 검색하는 커널
+	size_t (*indexOf)(const int *data, size_t n, int datum);
+	// 지정한 값의 마지막 인덱스를 검색하는 커널
+	size_t (*lastIndexOf)(const int *data, size_t n, int datum);
+	// 지정한 값의 개수를 세는 커널
+	size_t (*count)(const int *data, size_t n, int datum);
+	// 지정한 값으로 채우는 커널 (isStreaming 이 YES 이면 캐시를 거치지 않는 streaming store 사용)
+	void (*fill)(int *data, size_t n, int datum, int isStreaming);
+	// 원소들을 제자리에서 역순으로 저장하는 커널
+	void (*reverse)(int *data, size_t n);
+	// 문자열에서 지정한 바이트의 개수를 세는 커널
+	size_t (*countByte)(const char *data, size_t n, char byte);
+	// 조건 서술자와 일치하는 첫 번째 인덱스를 검색하는 커널
+	size_t (*findWhere)(const int *data, size_t n, const struct dynamicIntArrayPredicateProgram_s *program);
+	// 조건 서술자와 일치하는 원소의 개수를 세는 커널
+	size_t (*countWhere)(const int *data, size_t n, const struct dynamicIntArrayPredicateProgram_s *program);
+	// 조건 서술자와 일치하는 원소들을 순서대로 out 에 모으는 커널 (out 은 n 개를 저장할 수 있어야 함, 모은 개수 반환)
+	size_t (*filterWhere)(const int *data, size_t n, const struct dynamicIntArrayPredicateProgram_s *program, int *out);
+	// 원소들의 합을 64 비트로 누적해서 구하는 커널
+	int64_t (*sum)(const int *data, size_t n);
+	// 원소들의 최솟값과 최댓값을 함께 구하는 커널 (n 은 1 이상)
+	void (*minMax)(const int *data, size_t n, int *min, int *max);
+};
+
+///////////////////////////////////////////////////////////////////////////////////////
+/// Functions for SIMD kernels
+///////////////////////////////////////////////////////////////////////////////////////
+
+// 프로그램 시작 시 cpuid 로 한 번 선택되는 커널 테이블
+extern simdKernels_t simdKernels;
+
+int simdSetLevel(int level);
+int simdGetLevel(void);
+const char *simdGetLevelName(int level);
+
+void simdSetStreamingThreshold(size_t bytes);
+size_t simdGetStreamingThreshold(void);
+void simdFill(int *data, size_t n, int datum);
+
+#endif // #ifndef __DYNAMIC_INT_ARRAY_SIMD_H__
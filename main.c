@@ -9,6 +9,7 @@ int compareIntEven(int value);
 int compareIntPositive(int value);
 int compareIntNegative(int value);
 int compareIntZero(int value);
+int compareIntGreaterThan(int value, void *context);
 
 ///////////////////////////////////////////////////////////////////////////////////////
 /// Main function
@@ -166,6 +167,33 @@ int main(int argc, char **argv)
 	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
 	//////////////////////////////////////////////////////////////
 
+	//////////////////////////////////////////////////////////////
+	printMsg("[INSERT_RANGE TEST]", NORMAL, 0);
+	printMsg("인덱스 2에 { 7, 8, 9 }를 추가", NORMAL, 0);
+	int rangeData[3] = { 7, 8, 9 };
+	insertatResult = dynamicIntArrayInsertRange(array, 2, rangeData, 3);
+	if (insertatResult == NULL)
+	{
+		printMsg("dynamicIntArrayInsertRange 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[REMOVE_RANGE TEST]", NORMAL, 0);
+	printMsg("인덱스 2부터 3개의 값 제거", NORMAL, 0);
+	removeatResult = dynamicIntArrayRemoveRange(array, 2, 3);
+	if (removeatResult == NULL)
+	{
+		printMsg("dynamicIntArrayRemoveRange 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+	//////////////////////////////////////////////////////////////
+
 	//////////////////////////////////////////////////////////////
 	printMsg("[CLONE TEST]", NORMAL, 0);
 	dynamicIntArray_t *array2 = dynamicIntArrayClone(array);
@@ -205,6 +233,52 @@ int main(int argc, char **argv)
 	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
 	//////////////////////////////////////////////////////////////
 
+	//////////////////////////////////////////////////////////////
+	printMsg("[REVERSE_RANGE TEST]", NORMAL, 0);
+	printMsg("인덱스 4부터 3개를 reverse", NORMAL, 0);
+	reverseResult = dynamicIntArrayReverseRange(array, 4, 3);
+	if (reverseResult == FAIL)
+	{
+		printMsg("dynamicIntArrayReverseRange 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+
+	printMsg("인덱스 4부터 3개를 다시 reverse", NORMAL, 0);
+	reverseResult = dynamicIntArrayReverseRange(array, 4, 3);
+	if (reverseResult == FAIL)
+	{
+		printMsg("dynamicIntArrayReverseRange 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[ROTATE TEST]", NORMAL, 0);
+	printMsg("배열을 오른쪽으로 2칸 rotate", NORMAL, 0);
+	reverseResult = dynamicIntArrayRotate(array, 2);
+	if (reverseResult == FAIL)
+	{
+		printMsg("dynamicIntArrayRotate 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+
+	printMsg("배열을 왼쪽으로 2칸 rotate", NORMAL, 0);
+	reverseResult = dynamicIntArrayRotate(array, -2);
+	if (reverseResult == FAIL)
+	{
+		printMsg("dynamicIntArrayRotate 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+	//////////////////////////////////////////////////////////////
+
 	//////////////////////////////////////////////////////////////
 	printMsg("[INDEX_OF TEST]", NORMAL, 0);
 	printMsg("index_of(5)", NORMAL, 0);
@@ -285,6 +359,21 @@ int main(int argc, char **argv)
 	}
 	//////////////////////////////////////////////////////////////
 
+	//////////////////////////////////////////////////////////////
+	printMsg("[COUNT TEST]", NORMAL, 0);
+	printMsg("count(0)", NORMAL, 0);
+	int countResult = dynamicIntArrayCount(array, 0);
+	if (countResult == FAIL)
+	{
+		printMsg("dynamicIntArrayCount 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		printf("result : %d\n", countResult);
+	}
+	//////////////////////////////////////////////////////////////
+
 	//////////////////////////////////////////////////////////////
 	printMsg("[REMOVE_AT TEST]", NORMAL, 0);
 	printMsg("인덱스 0에 있는 값 삭제", NORMAL, 0);
@@ -337,6 +426,58 @@ int main(int argc, char **argv)
 	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
 	//////////////////////////////////////////////////////////////
 
+	//////////////////////////////////////////////////////////////
+	printMsg("[APPEND_ARRAY TEST]", NORMAL, 0);
+	printMsg("{ 7, 8, 9 }를 가진 배열을 추가한 후 추가한 3개의 값 제거", NORMAL, 0);
+	dynamicIntArray_t *array3 = dynamicIntArrayNewWithCapacity(3);
+	if ((array3 == NULL) || (dynamicIntArrayAppendN(array3, rangeData, 3) == NULL))
+	{
+		printMsg("dynamicIntArrayAppendN 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	appendResult = dynamicIntArrayAppendArray(array, array3);
+	if (appendResult == NULL)
+	{
+		printMsg("dynamicIntArrayAppendArray 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+	dynamicIntArrayRemoveRange(array, dynamicIntArrayGetSize(array) - 3, 3);
+	dynamicIntArrayDelete(&array3);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[CAPACITY TEST]", NORMAL, 0);
+	printMsg("크기와 용량 확인", NORMAL, 0);
+	printf("size : %d, capacity : %d\n", dynamicIntArrayGetSize(array), dynamicIntArrayGetCapacity(array));
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[RESERVE TEST]", NORMAL, 0);
+	printMsg("용량 100 예약", NORMAL, 0);
+	if (dynamicIntArrayReserve(array, 100) == FAIL)
+	{
+		printMsg("dynamicIntArrayReserve 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printf("size : %d, capacity : %d\n", dynamicIntArrayGetSize(array), dynamicIntArrayGetCapacity(array));
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[SHRINK_TO_FIT TEST]", NORMAL, 0);
+	printMsg("용량을 크기에 맞춤", NORMAL, 0);
+	if (dynamicIntArrayShrinkToFit(array) == FAIL)
+	{
+		printMsg("dynamicIntArrayShrinkToFit 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printf("size : %d, capacity : %d\n", dynamicIntArrayGetSize(array), dynamicIntArrayGetCapacity(array));
+	//////////////////////////////////////////////////////////////
+
 	//////////////////////////////////////////////////////////////
 	printMsg("[FIND TEST]", NORMAL, 0);
 	printMsg("find 짝수", NORMAL, 0);
@@ -511,6 +652,27 @@ int main(int argc, char **argv)
 	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
 	//////////////////////////////////////////////////////////////
 
+	//////////////////////////////////////////////////////////////
+	printMsg("[FILL_RANGE TEST]", NORMAL, 0);
+	printMsg("인덱스 1부터 2개를 7로 채움", NORMAL, 0);
+	fillResult = dynamicIntArrayFillRange(array, 1, 2, 7);
+	if (fillResult == FAIL)
+	{
+		printMsg("dynamicIntArrayFillRange 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array), NORMAL, 0);
+
+	printMsg("배열을 다시 5로 채움", NORMAL, 0);
+	fillResult = dynamicIntArrayFill(array, 5);
+	if (fillResult == FAIL)
+	{
+		printMsg("dynamicIntArrayFill 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	//////////////////////////////////////////////////////////////
+
 	//////////////////////////////////////////////////////////////
 	printMsg("[SET TEST]", NORMAL, 0);
 	printMsg("인덱스 2에 10을 저장", NORMAL, 0);
@@ -567,6 +729,535 @@ int main(int argc, char **argv)
 	}
 	//////////////////////////////////////////////////////////////
 
+	//////////////////////////////////////////////////////////////
+	printMsg("[LAST_ERROR TEST]", NORMAL, 0);
+	printMsg("출력 없이 인덱스 20의 값을 가져온 후 오류 코드 확인", NORMAL, 0);
+	printSetLevel(QUIET);
+	dynamicIntArrayClearLastError();
+	getResult = dynamicIntArrayGetElement(array, 20, isError);
+	printSetLevel(DEBUG);
+	if (*isError == FAIL)
+	{
+		printf("result : %d (%s)\n", dynamicIntArrayGetLastError(), dynamicIntArrayGetErrorString(dynamicIntArrayGetLastError()));
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[GET_UNCHECKED TEST]", NORMAL, 0);
+	printMsg("인덱스 2의 값을 검사 없이 가져옴", NORMAL, 0);
+	printf("result : %d\n", dynamicIntArrayGetUnchecked(array, 2));
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[FORMAT_TO TEST]", NORMAL, 0);
+	printMsg("필요한 길이를 확인한 후 12 바이트 버퍼에 문자열로 저장", NORMAL, 0);
+	char formatBuffer[12];
+	printf("required length : %zd\n", dynamicIntArrayFormatTo(array, NULL, 0));
+	printf("written length : %zd\n", dynamicIntArrayFormatTo(array, formatBuffer, sizeof(formatBuffer)));
+	printf("buffer : %s\n", formatBuffer);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[WRITE_TO TEST]", NORMAL, 0);
+	printMsg("배열을 표준 출력 스트림에 바로 씀", NORMAL, 0);
+	if (dynamicIntArrayWriteToFile(array, stdout) == FAIL)
+	{
+		printMsg("dynamicIntArrayWriteToFile 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	printf("\n");
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[FROM_STRING TEST]", NORMAL, 0);
+	printMsg("배열의 문자열로부터 새 배열 생성", NORMAL, 0);
+	dynamicIntArray_t *array4 = dynamicIntArrayFromString(dynamicIntArrayToString(array));
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayFromString 실패.", ERROR, 0);
+		//return FAIL;
+	}
+
+	printMsg(dynamicIntArrayToString(array4), NORMAL, 0);
+	dynamicIntArrayDelete(&array4);
+
+	printMsg("잘못된 문자열 \"{ 1, 2 \"로부터 새 배열 생성", NORMAL, 0);
+	array4 = dynamicIntArrayFromString("{ 1, 2 ");
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayFromString 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[SAVE_LOAD TEST]", NORMAL, 0);
+	printMsg("배열을 임시 파일에 이진 형식으로 저장한 후 다시 읽음", NORMAL, 0);
+	FILE *binaryFile = tmpfile();
+	if (binaryFile == NULL)
+	{
+		printMsg("tmpfile 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		if (dynamicIntArraySave(array, fileno(binaryFile), YES) == FAIL)
+		{
+			printMsg("dynamicIntArraySave 실패.", ERROR, 0);
+			//return FAIL;
+		}
+
+		rewind(binaryFile);
+		array4 = dynamicIntArrayLoad(fileno(binaryFile));
+		if (array4 == NULL)
+		{
+			printMsg("dynamicIntArrayLoad 실패.", ERROR, 0);
+			//return FAIL;
+		}
+		else
+		{
+			printMsg(dynamicIntArrayToString(array4), NORMAL, 0);
+			dynamicIntArrayDelete(&array4);
+		}
+
+		fclose(binaryFile);
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[OPEN_MAPPED TEST]", NORMAL, 0);
+	printMsg("임시 파일을 읽기/쓰기로 매핑해서 원소를 추가한 후 읽기 전용으로 다시 매핑함", NORMAL, 0);
+	char mappedPath[] = "/tmp/dynamicIntArrayXXXXXX";
+	int mappedFd = mkstemp(mappedPath);
+	if (mappedFd < 0)
+	{
+		printMsg("mkstemp 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		close(mappedFd);
+
+		array4 = dynamicIntArrayOpenMapped(mappedPath, MAP_MODE_READ_WRITE);
+		if (array4 == NULL)
+		{
+			printMsg("dynamicIntArrayOpenMapped 실패.", ERROR, 0);
+			//return FAIL;
+		}
+		else
+		{
+			for (loopIndex = 0; loopIndex < 20; loopIndex++)
+			{
+				dynamicIntArrayAppend(array4, loopIndex * 3);
+			}
+			dynamicIntArraySync(array4);
+			dynamicIntArrayDelete(&array4);
+		}
+
+		array4 = dynamicIntArrayOpenMapped(mappedPath, MAP_MODE_READ_ONLY);
+		if (array4 == NULL)
+		{
+			printMsg("dynamicIntArrayOpenMapped 실패.", ERROR, 0);
+			//return FAIL;
+		}
+		else
+		{
+			printMsg(dynamicIntArrayToString(array4), NORMAL, 0);
+			printf("index of 27 : %d\n", dynamicIntArrayIndexOf(array4, 27));
+
+			printMsg("읽기 전용 배열에 원소 추가 시도", NORMAL, 0);
+			if (dynamicIntArrayAppend(array4, 100) == NULL)
+			{
+				printf("result : %d (%s)\n", dynamicIntArrayGetLastError(), dynamicIntArrayGetErrorString(dynamicIntArrayGetLastError()));
+			}
+			dynamicIntArrayDelete(&array4);
+		}
+
+		unlink(mappedPath);
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[SHARED TEST]", NORMAL, 0);
+	printMsg("공유 메모리 배열을 생성하고 읽기 전용으로 연결한 후 원소 추가를 게시함", NORMAL, 0);
+	array4 = dynamicIntArrayCreateShared("/dynamicIntArrayTest", 4);
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayCreateShared 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		dynamicIntArrayUnlinkShared("/dynamicIntArrayTest");
+
+		dynamicIntArray_t *sharedReader = dynamicIntArrayAttachSharedFd(dup(dynamicIntArrayGetSharedFd(array4)), MAP_MODE_READ_ONLY);
+		if (sharedReader == NULL)
+		{
+			printMsg("dynamicIntArrayAttachSharedFd 실패.", ERROR, 0);
+			//return FAIL;
+		}
+		else
+		{
+			for (loopIndex = 0; loopIndex < 10; loopIndex++)
+			{
+				dynamicIntArrayAppend(array4, loopIndex * loopIndex);
+			}
+			printf("before sync : %d\n", dynamicIntArrayGetSize(sharedReader));
+
+			dynamicIntArraySync(array4);
+			dynamicIntArrayRefresh(sharedReader);
+			printf("after sync : %d\n", dynamicIntArrayGetSize(sharedReader));
+			printMsg(dynamicIntArrayToString(sharedReader), NORMAL, 0);
+			dynamicIntArrayDelete(&sharedReader);
+		}
+
+		dynamicIntArrayDelete(&array4);
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[HUGE TEST]", NORMAL, 0);
+	printMsg("큰 배열 모드 기준 크기를 4096 바이트로 낮춘 후 원소를 추가해서 익명 매핑으로 전환함", NORMAL, 0);
+	dynamicIntArraySetHugeThreshold(4096);
+	array4 = dynamicIntArrayNew(16);
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayNew 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		printf("storage : %d, capacity : %d\n", array4->storageKind, dynamicIntArrayGetCapacity(array4));
+		for (loopIndex = 0; loopIndex < 2000; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, loopIndex);
+		}
+		printf("storage : %d, capacity : %d, aligned : %d, index of 1999 : %d\n", array4->storageKind, dynamicIntArrayGetCapacity(array4), (((uintptr_t)dynamicIntArrayGetArrayPtr(array4) % 64) == 0) ? YES : NO, dynamicIntArrayIndexOf(array4, 1999));
+		dynamicIntArrayDelete(&array4);
+	}
+	dynamicIntArraySetHugeThreshold(0);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[64BIT TEST]", NORMAL, 0);
+	printMsg("size_t 크기와 인덱스를 사용하는 함수들로 생성, 저장, 검색, 복사함", NORMAL, 0);
+	array4 = dynamicIntArrayNew64((size_t)10);
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayNew64 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		size_t index64 = 0;
+		for ( ; index64 < dynamicIntArrayGetSize64(array4); index64++)
+		{
+			dynamicIntArraySetElement64(array4, index64, (int)(index64 * 10));
+		}
+		dynamicIntArrayCopy64(array4, 0, array4, 5, 5);
+		printf("array4 : %s\n", dynamicIntArrayToString(array4));
+		printf("size : %zu, capacity : %zu, index of 70 : %zu, last index of 70 : %zu, count of 70 : %zu\n", dynamicIntArrayGetSize64(array4), dynamicIntArrayGetCapacity64(array4), dynamicIntArrayIndexOf64(array4, 70), dynamicIntArrayLastIndexOf64(array4, 70), dynamicIntArrayCount64(array4, 70));
+		printf("index of 5 is NPOS : %d\n", (dynamicIntArrayIndexOf64(array4, 5) == DYNAMIC_INT_ARRAY_NPOS) ? YES : NO);
+		dynamicIntArrayDelete(&array4);
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[ALLOCATOR TEST]", NORMAL, 0);
+	printMsg("아레나 할당자와 풀 할당자로 동적 배열을 생성하고 한 번에 해제함", NORMAL, 0);
+	dynamicIntArrayArena_t arena;
+	if (dynamicIntArrayArenaInitialize(&arena, 0) == FAIL)
+	{
+		printMsg("dynamicIntArrayArenaInitialize 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 100; loopIndex++)
+		{
+			array4 = dynamicIntArrayNewWithAllocator(4, &arena.allocator);
+			if (array4 == NULL) break;
+			dynamicIntArrayAppend(array4, loopIndex);
+			dynamicIntArrayAppend(array4, loopIndex * 2);
+		}
+		if (array4 != NULL)
+		{
+			printf("arena array4 : %s, uses arena : %d\n", dynamicIntArrayToString(array4), (dynamicIntArrayGetAllocator(array4) == &arena.allocator) ? YES : NO);
+		}
+		// 아레나로 생성한 동적 배열은 하나씩 삭제하지 않고 Reset 으로 한 번에 해제
+		dynamicIntArrayArenaReset(&arena);
+		array4 = NULL;
+		dynamicIntArrayArenaFinal(&arena);
+	}
+
+	dynamicIntArrayPool_t pool;
+	if (dynamicIntArrayPoolInitialize(&pool) == FAIL)
+	{
+		printMsg("dynamicIntArrayPoolInitialize 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 100; loopIndex++)
+		{
+			array4 = dynamicIntArrayNewWithAllocator(8, &pool.allocator);
+			if (array4 == NULL) break;
+			dynamicIntArrayAppend(array4, loopIndex);
+			// 풀 할당자는 해제한 조각을 free list 로 다시 사용
+			if (loopIndex < 99) dynamicIntArrayDelete(&array4);
+		}
+		if (array4 != NULL)
+		{
+			printf("pool array4 : %s\n", dynamicIntArrayToString(array4));
+			dynamicIntArrayDelete(&array4);
+		}
+		dynamicIntArrayPoolFinal(&pool);
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[RECYCLE TEST]", NORMAL, 0);
+	printMsg("작은 동적 배열을 반복해서 생성하고 삭제하면서 재사용 캐시 통계를 확인함", NORMAL, 0);
+	dynamicIntArrayRecycleStats_t recycleStats;
+	for (loopIndex = 0; loopIndex < 1000; loopIndex++)
+	{
+		array4 = dynamicIntArrayNew(8);
+		if (array4 == NULL) break;
+		dynamicIntArrayAppend(array4, loopIndex);
+		dynamicIntArrayDelete(&array4);
+	}
+	if (dynamicIntArrayGetRecycleStats(&recycleStats) == SUCCESS)
+	{
+		printf("hits : %zu, misses : %zu, cached headers : %zu, cached buffers : %zu, cached bytes : %zu\n", recycleStats.hits, recycleStats.misses, recycleStats.cachedHeaders, recycleStats.cachedBuffers, recycleStats.cachedBytes);
+	}
+	printf("trimmed bytes : %zu\n", dynamicIntArrayTrimRecycle());
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[INLINE TEST]", NORMAL, 0);
+	printMsg("인라인 저장소 용량 이하의 동적 배열은 구조체 안에 원소를 저장하고, 넘치면 힙으로 옮김", NORMAL, 0);
+	array4 = dynamicIntArrayNew(4);
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayNew 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		printf("size : %d, capacity : %d, is inline : %d\n", dynamicIntArrayGetSize(array4), dynamicIntArrayGetCapacity(array4), (dynamicIntArrayGetArrayPtr(array4) == array4->inlineData) ? YES : NO);
+		for (loopIndex = 0; loopIndex < DYNAMIC_INT_ARRAY_INLINE_CAPACITY; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, loopIndex);
+		}
+		printf("size : %d, capacity : %d, is inline : %d\n", dynamicIntArrayGetSize(array4), dynamicIntArrayGetCapacity(array4), (dynamicIntArrayGetArrayPtr(array4) == array4->inlineData) ? YES : NO);
+		dynamicIntArrayResize(array4, 4, YES);
+		dynamicIntArrayShrinkToFit(array4);
+		printf("array4 : %s, is inline : %d\n", dynamicIntArrayToString(array4), (dynamicIntArrayGetArrayPtr(array4) == array4->inlineData) ? YES : NO);
+		dynamicIntArrayDelete(&array4);
+	}
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[MOVE TEST]", NORMAL, 0);
+	printMsg("원소를 복사하지 않고 동적 배열끼리 맞바꾸거나 옮기고, 외부 메모리를 넘겨받거나 넘겨줌", NORMAL, 0);
+	array4 = dynamicIntArrayNewWithCapacity(32);
+	dynamicIntArray_t *moved = dynamicIntArrayNewWithCapacity(4);
+	if ((array4 == NULL) || (moved == NULL))
+	{
+		printMsg("dynamicIntArrayNewWithCapacity 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 20; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, loopIndex);
+		}
+		dynamicIntArrayAppend(moved, -1);
+		dynamicIntArraySwap(array4, moved);
+		printf("swap, array4 size : %d, moved size : %d\n", dynamicIntArrayGetSize(array4), dynamicIntArrayGetSize(moved));
+		dynamicIntArrayMove(array4, moved);
+		printf("move, array4 size : %d, moved size : %d\n", dynamicIntArrayGetSize(array4), dynamicIntArrayGetSize(moved));
+
+		int releasedSize = 0;
+		int *released = dynamicIntArrayRelease(array4, &releasedSize);
+		if (released != NULL)
+		{
+			printf("release, size : %d, last : %d, array4 size : %d\n", releasedSize, released[releasedSize - 1], dynamicIntArrayGetSize(array4));
+			if (dynamicIntArrayAdopt(moved, released, releasedSize, releasedSize, free) == FAIL)
+			{
+				free(released);
+			}
+			printf("adopt, moved : %s\n", dynamicIntArrayToString(moved));
+		}
+	}
+	dynamicIntArrayDelete(&moved);
+	dynamicIntArrayDelete(&array4);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[COW TEST]", NORMAL, 0);
+	printMsg("원소를 복사하지 않고 원소 저장소를 함께 사용하다가 처음 변경할 때 분리하는 복제본 생성", NORMAL, 0);
+	array4 = dynamicIntArrayNewWithCapacity(100);
+	dynamicIntArray_t *snapshot = NULL;
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayNewWithCapacity 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 100; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, loopIndex);
+		}
+		snapshot = dynamicIntArrayCloneCow(array4);
+		printf("clone, share count : %zu, same buffer : %d\n", dynamicIntArrayGetShareCount(array4), (dynamicIntArrayGetArrayPtr(array4) == dynamicIntArrayGetArrayPtr(snapshot)) ? YES : NO);
+
+		dynamicIntArraySetElement(array4, 0, -1);
+		printf("set, array4[0] : %d, snapshot[0] : %d, share count : %zu, %zu\n", dynamicIntArrayGetElement(array4, 0, isError), dynamicIntArrayGetElement(snapshot, 0, isError), dynamicIntArrayGetShareCount(array4), dynamicIntArrayGetShareCount(snapshot));
+	}
+	dynamicIntArrayDelete(&snapshot);
+	dynamicIntArrayDelete(&array4);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[VIEW TEST]", NORMAL, 0);
+	printMsg("원소를 복사하지 않고 동적 배열의 일부 구간을 가리키는 뷰로 검색하고 변경", NORMAL, 0);
+	array4 = dynamicIntArrayNewWithCapacity(20);
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayNewWithCapacity 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 20; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, loopIndex % 5);
+		}
+
+		dynamicIntArrayView_t window;
+		dynamicIntArrayView_t evens;
+		if ((dynamicIntArrayViewOfMutable(array4, 5, 10, &window) == SUCCESS)
+			&& (dynamicIntArrayViewSlice(&window, 0, 5, 2, &evens) == SUCCESS))
+		{
+			printf("window [5, 15), indexOf 3 : %zu, lastIndexOf 3 : %zu, count 0 : %zu\n", dynamicIntArrayViewIndexOf(&window, 3), dynamicIntArrayViewLastIndexOf(&window, 3), dynamicIntArrayViewCount(&window, 0));
+			dynamicIntArrayViewReverse(&window);
+			dynamicIntArrayViewFill(&evens, -1);
+			printf("reverse window, fill every 2nd with -1 : %s\n", dynamicIntArrayToString(array4));
+		}
+	}
+	dynamicIntArrayDelete(&array4);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[PREDICATE TEST]", NORMAL, 0);
+	printMsg("문맥을 함께 전달받는 조건 함수로 검색, 개수 세기, 삭제, 분할", NORMAL, 0);
+	array4 = dynamicIntArrayNewWithCapacity(20);
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayNewWithCapacity 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 20; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, (loopIndex * 7) % 20);
+		}
+		printf("array4 : %s\n", dynamicIntArrayToString(array4));
+
+		int threshold = 14;
+		size_t indices[4];
+		size_t allCount = dynamicIntArrayFindAllIf(array4, compareIntGreaterThan, &threshold, indices, 4);
+		printf("value > %d, first : %zu, last : %zu, count : %zu, all : %zu (first 4 : %zu %zu %zu %zu)\n", threshold,
+			dynamicIntArrayFindIf(array4, compareIntGreaterThan, &threshold), dynamicIntArrayFindLastIf(array4, compareIntGreaterThan, &threshold),
+			dynamicIntArrayCountIf(array4, compareIntGreaterThan, &threshold), allCount, indices[0], indices[1], indices[2], indices[3]);
+
+		threshold = 9;
+		printf("partition value > %d, boundary : %zu, array4 : ", threshold, dynamicIntArrayPartition(array4, compareIntGreaterThan, &threshold));
+		printf("%s\n", dynamicIntArrayToString(array4));
+		printf("remove value > %d, removed : %zu, array4 : ", threshold, dynamicIntArrayRemoveIf(array4, compareIntGreaterThan, &threshold));
+		printf("%s\n", dynamicIntArrayToString(array4));
+	}
+	dynamicIntArrayDelete(&array4);
+	//////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////
+	printMsg("[PREDICATE PROGRAM TEST]", NORMAL, 0);
+	printMsg("조건 함수 대신 선언적 조건 서술자를 컴파일해서 SIMD 커널로 검색, 개수 세기, 필터링", NORMAL, 0);
+	array4 = dynamicIntArrayNewWithCapacity(20);
+	dynamicIntArray_t *filtered = dynamicIntArrayNewWithCapacity(4);
+	if ((array4 == NULL) || (filtered == NULL))
+	{
+		printMsg("dynamicIntArrayNewWithCapacity 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 20; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, loopIndex - 10);
+		}
+
+		// 짝수이면서 [-5, 5] 구간에 있고 0 이 아닌 값 (compareIntEven, compareIntZero 와 같은 조건의 조합)
+		dynamicIntArrayPredicate_t isEven = { PREDICATE_OP_EVEN, 0, 0, NULL, NULL };
+		dynamicIntArrayPredicate_t inRange = { PREDICATE_OP_RANGE, -5, 5, NULL, NULL };
+		dynamicIntArrayPredicate_t isNonZero = { PREDICATE_OP_NOT_EQUAL, 0, 0, NULL, NULL };
+		dynamicIntArrayPredicate_t evenInRange = { PREDICATE_OP_AND, 0, 0, &isEven, &inRange };
+		dynamicIntArrayPredicate_t predicate = { PREDICATE_OP_AND, 0, 0, &evenInRange, &isNonZero };
+		dynamicIntArrayPredicateProgram_t program;
+		if (dynamicIntArrayPredicateCompile(&predicate, &program) == SUCCESS)
+		{
+			printf("even, [-5, 5], non zero : find %zu, count %zu, steps %zu\n", dynamicIntArrayFindWhere(array4, &program), dynamicIntArrayCountWhere(array4, &program), program.stepCount);
+			dynamicIntArrayFilterWhere(array4, &program, filtered);
+			printf("filter : %s\n", dynamicIntArrayToString(filtered));
+		}
+	}
+	dynamicIntArrayDelete(&filtered);
+	dynamicIntArrayDelete(&array4);
+	//////////////////////////////////////////////////////////////
+
+	printMsg("[REDUCTION TEST]", NORMAL, 0);
+	printMsg("SIMD 커널로 합(64 비트 누적), 최솟값, 최댓값, 최솟값/최댓값 인덱스, 평균 구하기", NORMAL, 0);
+	array4 = dynamicIntArrayNewWithCapacity(10);
+	if (array4 == NULL)
+	{
+		printMsg("dynamicIntArrayNewWithCapacity 실패.", ERROR, 0);
+		//return FAIL;
+	}
+	else
+	{
+		for (loopIndex = 0; loopIndex < 10; loopIndex++)
+		{
+			dynamicIntArrayAppend(array4, (loopIndex % 2 == 0) ? INT_MAX - loopIndex : loopIndex);
+		}
+
+		int64_t sum = 0;
+		int min = 0;
+		int max = 0;
+		double mean = 0.0;
+		if ((dynamicIntArraySum(array4, &sum) == SUCCESS)
+			&& (dynamicIntArrayMinMax(array4, &min, &max) == SUCCESS)
+			&& (dynamicIntArrayMean(array4, &mean) == SUCCESS))
+		{
+			printf("sum %lld, min %d (index %zu), max %d (index %zu), mean %.1f\n", (long long)sum, min, dynamicIntArrayArgMin(array4), max, dynamicIntArrayArgMax(array4), mean);
+		}
+
+		// 홀수 인덱스 원소들만 가리키는 뷰의 합
+		dynamicIntArrayView_t view;
+		dynamicIntArrayView_t oddView;
+		if ((dynamicIntArrayViewOf(array4, 1, 9, &view) == SUCCESS)
+			&& (dynamicIntArrayViewSlice(&view, 0, 5, 2, &oddView) == SUCCESS)
+			&& (dynamicIntArrayViewSum(&oddView, &sum) == SUCCESS))
+		{
+			printf("odd index sum %lld\n", (long long)sum);
+		}
+	}
+	dynamicIntArrayDelete(&array4);
+	//////////////////////////////////////////////////////////////
+
 	//////////////////////////////////////////////////////////////
 	dynamicIntArrayDelete(&array);
 
@@ -635,4 +1326,14 @@ int compareIntZero(int value)
 	return (value == 0) ? YES : NO;
 }
 
-
+/**
+ * @fn int compareIntGreaterThan(int value, void *context)
+ * @brief 정수가 문맥으로 전달받은 기준값보다 큰지 비교하는 함수
+ * @param value 비교할 정수
+ * @param context 기준값을 가리키는 int 포인터
+ * @return 기준값보다 크면 YES, 아니면 NO 반환
+ */
+int compareIntGreaterThan(int value, void *context)
+{
+	return (value > *(const int*)context) ? YES : NO;
+}